@@ -0,0 +1,82 @@
+/**
+ * @file BoundingBox.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A File for the BoundingBox Class implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the BoundingBox Class implementation.
+ * Define the BoundingBox Class methods and fields.
+ * A BoundingBox class is the smallest rectangle with edges parallel to the axes which contains
+ * a set of Points in the plane.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <limits>
+#include <algorithm>
+#include "BoundingBox.h"
+
+
+/*-----=  BoundingBox Constructors & Destructors  =-----*/
+
+
+/**
+ * @brief A Constructor for the BoundingBox, which creates an empty Bounding Box that contains
+ *        no Points.
+ */
+BoundingBox::BoundingBox() : _minX(std::numeric_limits<CordType>::infinity()),
+                             _minY(std::numeric_limits<CordType>::infinity()),
+                             _maxX(-std::numeric_limits<CordType>::infinity()),
+                             _maxY(-std::numeric_limits<CordType>::infinity())
+{
+
+}
+
+/**
+ * @brief A Constructor for the BoundingBox, which receive the bounds of the Bounding Box.
+ * @param minX The smallest X value in the Bounding Box.
+ * @param minY The smallest Y value in the Bounding Box.
+ * @param maxX The largest X value in the Bounding Box.
+ * @param maxY The largest Y value in the Bounding Box.
+ */
+BoundingBox::BoundingBox(CordType const minX, CordType const minY, CordType const maxX,
+                         CordType const maxY) : _minX(minX), _minY(minY), _maxX(maxX), _maxY(maxY)
+{
+
+}
+
+
+/*-----=  BoundingBox Methods  =-----*/
+
+
+/**
+ * @brief Expand the Bounding Box so it will also contain the given Point.
+ * @param point The Point to contain.
+ */
+void BoundingBox::expand(const Point& point)
+{
+    _minX = std::min(_minX, point.getX());
+    _minY = std::min(_minY, point.getY());
+    _maxX = std::max(_maxX, point.getX());
+    _maxY = std::max(_maxY, point.getY());
+}
+
+/**
+ * @brief Expand the Bounding Box so it will also contain the given Bounding Box.
+ * @param other The Bounding Box to contain.
+ */
+void BoundingBox::expand(const BoundingBox& other)
+{
+    _minX = std::min(_minX, other._minX);
+    _minY = std::min(_minY, other._minY);
+    _maxX = std::max(_maxX, other._maxX);
+    _maxY = std::max(_maxY, other._maxY);
+}
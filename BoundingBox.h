@@ -0,0 +1,122 @@
+/**
+ * @file BoundingBox.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header File for the BoundingBox Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the BoundingBox Class.
+ * Declaring the BoundingBox Class, it's methods and fields.
+ * A BoundingBox class is the smallest rectangle with edges parallel to the axes which contains
+ * a set of Points in the plane.
+ */
+
+
+#ifndef BOUNDINGBOX_H
+#define BOUNDINGBOX_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include "Point.h"
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class representing an axis aligned Bounding Box.
+ *        The Bounding Box holds the smallest and largest X and Y values of a set of Points, and
+ *        can determine quickly if two sets of Points are too far apart to intersect.
+ */
+class BoundingBox
+{
+public:
+
+    /**
+     * @brief A Constructor for the BoundingBox, which creates an empty Bounding Box that contains
+     *        no Points.
+     */
+    BoundingBox();
+
+    /**
+     * @brief A Constructor for the BoundingBox, which receive the bounds of the Bounding Box.
+     * @param minX The smallest X value in the Bounding Box.
+     * @param minY The smallest Y value in the Bounding Box.
+     * @param maxX The largest X value in the Bounding Box.
+     * @param maxY The largest Y value in the Bounding Box.
+     */
+    BoundingBox(CordType const minX, CordType const minY, CordType const maxX,
+                CordType const maxY);
+
+    /**
+     * @brief Returns the smallest X value in the Bounding Box.
+     * @return The smallest X value in the Bounding Box.
+     */
+    CordType getMinX() const { return _minX; };
+
+    /**
+     * @brief Returns the smallest Y value in the Bounding Box.
+     * @return The smallest Y value in the Bounding Box.
+     */
+    CordType getMinY() const { return _minY; };
+
+    /**
+     * @brief Returns the largest X value in the Bounding Box.
+     * @return The largest X value in the Bounding Box.
+     */
+    CordType getMaxX() const { return _maxX; };
+
+    /**
+     * @brief Returns the largest Y value in the Bounding Box.
+     * @return The largest Y value in the Bounding Box.
+     */
+    CordType getMaxY() const { return _maxY; };
+
+    /**
+     * @brief Determine if the Bounding Box contains no Points.
+     * @return true if the Bounding Box is empty, false otherwise.
+     */
+    bool isEmpty() const { return _minX > _maxX; };
+
+    /**
+     * @brief Expand the Bounding Box so it will also contain the given Point.
+     * @param point The Point to contain.
+     */
+    void expand(const Point& point);
+
+    /**
+     * @brief Expand the Bounding Box so it will also contain the given Bounding Box.
+     * @param other The Bounding Box to contain.
+     */
+    void expand(const BoundingBox& other);
+
+    /**
+     * @brief Determine if this Bounding Box and a given other Bounding Box overlap.
+     *        Bounding Boxes which only touch each other are considered overlapping, since the
+     *        Shapes inside them may still touch.
+     * @param other The Bounding Box to check with.
+     * @return true if the Bounding Boxes overlap, false otherwise.
+     */
+    bool overlaps(const BoundingBox& other) const
+    {
+        return _minX <= other._maxX && other._minX <= _maxX &&
+               _minY <= other._maxY && other._minY <= _maxY;
+    };
+
+private:
+    // BoundingBox Private Fields.
+    CordType _minX;  // The smallest X value in the Bounding Box.
+    CordType _minY;  // The smallest Y value in the Bounding Box.
+    CordType _maxX;  // The largest X value in the Bounding Box.
+    CordType _maxY;  // The largest Y value in the Bounding Box.
+};
+
+
+#endif
@@ -0,0 +1,319 @@
+/**
+ * @file EdgeBatch.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A File for the EdgeBatch Class implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the EdgeBatch Class implementation.
+ * Define the EdgeBatch Class, it's methods and fields.
+ * An EdgeBatch class holds the edges of many Shapes as columns: the X and Y coordinates of both
+ * Points of every edge, the coefficients of it's line and the Shape it belongs to. A query edge is
+ * checked against many edges of the batch at once, using the vector instructions of the machine.
+ * The instructions are chosen when the program runs: AVX2 checks 4 edges in an instruction, SSE2
+ * checks 2 edges, and on other machines the edges are checked one by one.
+ * Every kernel calculates the line values with the same products and sums in the same order as
+ * the line of an edge does, so all the kernels give the same results.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include "EdgeBatch.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define X86_VECTOR_KERNELS
+#endif
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def SSE2_LANES 2
+ * @brief A Macro that sets the amount of edges which an SSE2 instruction checks.
+ */
+#define SSE2_LANES 2
+
+/**
+ * @def AVX2_LANES 4
+ * @brief A Macro that sets the amount of edges which an AVX2 instruction checks.
+ */
+#define AVX2_LANES 4
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief A Struct representing the columns of the edges which a kernel checks, starting at the
+ *        first edge to check.
+ */
+struct EdgeColumns
+{
+    const CordType *x1;     // The X coordinates of the first Points of the edges.
+    const CordType *y1;     // The Y coordinates of the first Points of the edges.
+    const CordType *x2;     // The X coordinates of the second Points of the edges.
+    const CordType *y2;     // The Y coordinates of the second Points of the edges.
+    const CordType *a;      // The X coefficients of the lines of the edges.
+    const CordType *b;      // The Y coefficients of the lines of the edges.
+    const CordType *c;      // The constant coefficients of the lines of the edges.
+};
+
+/**
+ * @brief CrossingKernel is a method which finds the edges in the given columns that cross the
+ *        given query edge, out of the given amount of edges.
+ */
+typedef EdgeMask (*CrossingKernel)(const EdgeColumns& edges, size_t const count,
+                                   const QueryEdge& query);
+
+
+/*-----=  Crossing Kernels  =-----*/
+
+
+/**
+ * @brief Find the edges in the given range of the columns which cross the given query edge,
+ *        checking the edges one by one.
+ * @param edges The columns of the edges.
+ * @param first The index of the first edge to check.
+ * @param count The index after the last edge to check.
+ * @param query The edge to check.
+ * @return The set of the edges which cross the query edge, where bit i stands for the edge i.
+ */
+static EdgeMask findCrossingsFrom(const EdgeColumns& edges, size_t const first,
+                                  size_t const count, const QueryEdge& query)
+{
+    EdgeMask result = 0;
+    for (size_t i = first; i < count; i++)
+    {
+        EdgeLine line = {edges.a[i], edges.b[i], edges.c[i]};
+        bool crossesQuery = query.line.valueAt(edges.x1[i], edges.y1[i]) *
+                            query.line.valueAt(edges.x2[i], edges.y2[i]) < 0;
+        bool crossesEdge = line.valueAt(query.x1, query.y1) * line.valueAt(query.x2, query.y2) < 0;
+        result |= (EdgeMask) (crossesQuery && crossesEdge) << i;
+    }
+    return result;
+}
+
+/**
+ * @brief Find the edges in the given columns which cross the given query edge, checking the
+ *        edges one by one.
+ * @param edges The columns of the edges.
+ * @param count The amount of edges to check.
+ * @param query The edge to check.
+ * @return The set of the edges which cross the query edge, where bit i stands for the edge i.
+ */
+static EdgeMask findCrossingsScalar(const EdgeColumns& edges, size_t const count,
+                                    const QueryEdge& query)
+{
+    return findCrossingsFrom(edges, 0, count, query);
+}
+
+#ifdef X86_VECTOR_KERNELS
+
+/**
+ * @brief Find the edges in the given columns which cross the given query edge, checking 2 edges
+ *        in every SSE2 instruction.
+ * @param edges The columns of the edges.
+ * @param count The amount of edges to check.
+ * @param query The edge to check.
+ * @return The set of the edges which cross the query edge, where bit i stands for the edge i.
+ */
+__attribute__((target("sse2")))
+static EdgeMask findCrossingsSse2(const EdgeColumns& edges, size_t const count,
+                                  const QueryEdge& query)
+{
+    const __m128d zero = _mm_setzero_pd();
+    const __m128d queryA = _mm_set1_pd(query.line.a);
+    const __m128d queryB = _mm_set1_pd(query.line.b);
+    const __m128d queryC = _mm_set1_pd(query.line.c);
+    const __m128d queryX1 = _mm_set1_pd(query.x1);
+    const __m128d queryY1 = _mm_set1_pd(query.y1);
+    const __m128d queryX2 = _mm_set1_pd(query.x2);
+    const __m128d queryY2 = _mm_set1_pd(query.y2);
+
+    EdgeMask result = 0;
+    size_t i = 0;
+    for (; i + SSE2_LANES <= count; i += SSE2_LANES)
+    {
+        // The sides of the Points of the edges according to the line of the query edge.
+        __m128d firstSide = _mm_add_pd(_mm_add_pd(_mm_mul_pd(queryA, _mm_loadu_pd(edges.x1 + i)),
+                                                  _mm_mul_pd(queryB, _mm_loadu_pd(edges.y1 + i))),
+                                       queryC);
+        __m128d secondSide = _mm_add_pd(_mm_add_pd(_mm_mul_pd(queryA, _mm_loadu_pd(edges.x2 + i)),
+                                                   _mm_mul_pd(queryB, _mm_loadu_pd(edges.y2 + i))),
+                                        queryC);
+
+        // The sides of the Points of the query edge according to the lines of the edges.
+        __m128d a = _mm_loadu_pd(edges.a + i);
+        __m128d b = _mm_loadu_pd(edges.b + i);
+        __m128d c = _mm_loadu_pd(edges.c + i);
+        __m128d firstQuerySide = _mm_add_pd(_mm_add_pd(_mm_mul_pd(a, queryX1),
+                                                       _mm_mul_pd(b, queryY1)), c);
+        __m128d secondQuerySide = _mm_add_pd(_mm_add_pd(_mm_mul_pd(a, queryX2),
+                                                        _mm_mul_pd(b, queryY2)), c);
+
+        __m128d crosses = _mm_and_pd(_mm_cmplt_pd(_mm_mul_pd(firstSide, secondSide), zero),
+                                     _mm_cmplt_pd(_mm_mul_pd(firstQuerySide, secondQuerySide),
+                                                  zero));
+        result |= (EdgeMask) _mm_movemask_pd(crosses) << i;
+    }
+    return result | findCrossingsFrom(edges, i, count, query);
+}
+
+/**
+ * @brief Find the edges in the given columns which cross the given query edge, checking 4 edges
+ *        in every AVX2 instruction.
+ * @param edges The columns of the edges.
+ * @param count The amount of edges to check.
+ * @param query The edge to check.
+ * @return The set of the edges which cross the query edge, where bit i stands for the edge i.
+ */
+__attribute__((target("avx2")))
+static EdgeMask findCrossingsAvx2(const EdgeColumns& edges, size_t const count,
+                                  const QueryEdge& query)
+{
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d queryA = _mm256_set1_pd(query.line.a);
+    const __m256d queryB = _mm256_set1_pd(query.line.b);
+    const __m256d queryC = _mm256_set1_pd(query.line.c);
+    const __m256d queryX1 = _mm256_set1_pd(query.x1);
+    const __m256d queryY1 = _mm256_set1_pd(query.y1);
+    const __m256d queryX2 = _mm256_set1_pd(query.x2);
+    const __m256d queryY2 = _mm256_set1_pd(query.y2);
+
+    EdgeMask result = 0;
+    size_t i = 0;
+    for (; i + AVX2_LANES <= count; i += AVX2_LANES)
+    {
+        // The sides of the Points of the edges according to the line of the query edge.
+        __m256d firstSide = _mm256_add_pd(
+                _mm256_add_pd(_mm256_mul_pd(queryA, _mm256_loadu_pd(edges.x1 + i)),
+                              _mm256_mul_pd(queryB, _mm256_loadu_pd(edges.y1 + i))), queryC);
+        __m256d secondSide = _mm256_add_pd(
+                _mm256_add_pd(_mm256_mul_pd(queryA, _mm256_loadu_pd(edges.x2 + i)),
+                              _mm256_mul_pd(queryB, _mm256_loadu_pd(edges.y2 + i))), queryC);
+
+        // The sides of the Points of the query edge according to the lines of the edges.
+        __m256d a = _mm256_loadu_pd(edges.a + i);
+        __m256d b = _mm256_loadu_pd(edges.b + i);
+        __m256d c = _mm256_loadu_pd(edges.c + i);
+        __m256d firstQuerySide = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(a, queryX1),
+                                                             _mm256_mul_pd(b, queryY1)), c);
+        __m256d secondQuerySide = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(a, queryX2),
+                                                              _mm256_mul_pd(b, queryY2)), c);
+
+        __m256d crosses = _mm256_and_pd(
+                _mm256_cmp_pd(_mm256_mul_pd(firstSide, secondSide), zero, _CMP_LT_OQ),
+                _mm256_cmp_pd(_mm256_mul_pd(firstQuerySide, secondQuerySide), zero, _CMP_LT_OQ));
+        result |= (EdgeMask) _mm256_movemask_pd(crosses) << i;
+    }
+    return result | findCrossingsFrom(edges, i, count, query);
+}
+
+#endif
+
+/**
+ * @brief Choose the fastest kernel which the machine that runs the program supports.
+ * @return The chosen kernel.
+ */
+static CrossingKernel chooseKernel()
+{
+#ifdef X86_VECTOR_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return findCrossingsAvx2;
+    }
+    if (__builtin_cpu_supports("sse2"))
+    {
+        return findCrossingsSse2;
+    }
+#endif
+    return findCrossingsScalar;
+}
+
+
+/*-----=  EdgeBatch Constructors  =-----*/
+
+
+/**
+ * @brief A Constructor for the EdgeBatch, which creates an empty batch.
+ */
+EdgeBatch::EdgeBatch()
+{
+
+}
+
+
+/*-----=  EdgeBatch Methods  =-----*/
+
+
+/**
+ * @brief Remove all the edges from the batch, keeping it's memory for the next use.
+ */
+void EdgeBatch::clear()
+{
+    _x1.clear();
+    _y1.clear();
+    _x2.clear();
+    _y2.clear();
+    _a.clear();
+    _b.clear();
+    _c.clear();
+    _owners.clear();
+}
+
+/**
+ * @brief Add all the edges of the given Shape to the end of the batch.
+ * @param shape The Shape which it's edges are added.
+ * @param owner The index of the Shape, which is kept for every edge.
+ */
+void EdgeBatch::add(const ShapeView& shape, ShapeIndex const owner)
+{
+    ShapeSize count = shape.getVertexCount();
+    for (ShapeSize i = 0; i < count; i++)
+    {
+        // The last edge connects the last Vertex with the first Vertex.
+        ShapeSize j = i + 1 == count ? 0 : i + 1;
+        const EdgeLine& line = shape.getEdge(i);
+        _x1.push_back(shape.getX(i));
+        _y1.push_back(shape.getY(i));
+        _x2.push_back(shape.getX(j));
+        _y2.push_back(shape.getY(j));
+        _a.push_back(line.a);
+        _b.push_back(line.b);
+        _c.push_back(line.c);
+        _owners.push_back(owner);
+    }
+}
+
+/**
+ * @brief Find the edges of the batch which cross the given query edge, i.e. the Points of the
+ *        query edge are on different sides of the line of the edge, and the Points of the edge
+ *        are on different sides of the line of the query edge. The result is the same as the
+ *        edge crossing check of the Shapes.
+ * @param query The edge to check.
+ * @param begin The index of the first edge to check. At most EDGE_BATCH_SIZE edges are checked.
+ * @return The set of the edges which cross the query edge, where bit i stands for the edge in
+ *         the index begin + i.
+ */
+EdgeMask EdgeBatch::findCrossings(const QueryEdge& query, size_t const begin) const
+{
+    // The kernel is chosen once, by the first thread which checks a batch.
+    static const CrossingKernel kernel = chooseKernel();
+
+    size_t count = std::min((size_t) EDGE_BATCH_SIZE, size() - begin);
+    EdgeColumns edges = {_x1.data() + begin, _y1.data() + begin, _x2.data() + begin,
+                         _y2.data() + begin, _a.data() + begin, _b.data() + begin,
+                         _c.data() + begin};
+    return kernel(edges, count, query);
+}
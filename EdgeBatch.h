@@ -0,0 +1,134 @@
+/**
+ * @file EdgeBatch.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header File for the EdgeBatch Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the EdgeBatch Class.
+ * Declaring the EdgeBatch Class, it's methods and fields.
+ * An EdgeBatch class holds the edges of many Shapes as columns: the X and Y coordinates of both
+ * Points of every edge, the coefficients of it's line and the Shape it belongs to. A query edge is
+ * checked against many edges of the batch at once, using the vector instructions of the machine.
+ * The instructions are chosen when the program runs: AVX2 checks 4 edges in an instruction, SSE2
+ * checks 2 edges, and on other machines the edges are checked one by one.
+ */
+
+
+#ifndef EDGEBATCH_H
+#define EDGEBATCH_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cstdint>
+#include <vector>
+#include "ShapeStore.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def EDGE_BATCH_SIZE 64
+ * @brief A Macro that sets the largest amount of edges which are checked in a single call, i.e.
+ *        the amount of bits in an EdgeMask.
+ */
+#define EDGE_BATCH_SIZE 64
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief EdgeMask is a set of edges in a batch, where bit i stands for the edge i after the first
+ *        edge which was checked.
+ */
+typedef uint64_t EdgeMask;
+
+/**
+ * @brief A Struct representing a query edge which is checked against the edges of a batch.
+ */
+struct QueryEdge
+{
+    CordType x1;        // The X coordinate of the first Point of the edge.
+    CordType y1;        // The Y coordinate of the first Point of the edge.
+    CordType x2;        // The X coordinate of the second Point of the edge.
+    CordType y2;        // The Y coordinate of the second Point of the edge.
+    EdgeLine line;      // The line of the edge.
+};
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class representing a batch of edges of many Shapes, kept as continuous columns, which
+ *        a query edge is checked against several edges at a time.
+ */
+class EdgeBatch
+{
+public:
+
+    /**
+     * @brief A Constructor for the EdgeBatch, which creates an empty batch.
+     */
+    EdgeBatch();
+
+    /**
+     * @brief Remove all the edges from the batch, keeping it's memory for the next use.
+     */
+    void clear();
+
+    /**
+     * @brief Add all the edges of the given Shape to the end of the batch.
+     * @param shape The Shape which it's edges are added.
+     * @param owner The index of the Shape, which is kept for every edge.
+     */
+    void add(const ShapeView& shape, ShapeIndex const owner);
+
+    /**
+     * @brief Returns the amount of edges in the batch.
+     * @return The amount of edges in the batch.
+     */
+    size_t size() const { return _owners.size(); };
+
+    /**
+     * @brief Returns the index of the Shape which the given edge belongs to.
+     * @param edge The index of the edge in the batch.
+     * @return The index of the Shape of the edge.
+     */
+    ShapeIndex getOwner(size_t const edge) const { return _owners[edge]; };
+
+    /**
+     * @brief Find the edges of the batch which cross the given query edge, i.e. the Points of the
+     *        query edge are on different sides of the line of the edge, and the Points of the edge
+     *        are on different sides of the line of the query edge. The result is the same as the
+     *        edge crossing check of the Shapes.
+     * @param query The edge to check.
+     * @param begin The index of the first edge to check. At most EDGE_BATCH_SIZE edges are checked.
+     * @return The set of the edges which cross the query edge, where bit i stands for the edge in
+     *         the index begin + i.
+     */
+    EdgeMask findCrossings(const QueryEdge& query, size_t const begin) const;
+
+private:
+    // EdgeBatch Private Fields.
+    std::vector<CordType> _x1;          // The X coordinates of the first Points of the edges.
+    std::vector<CordType> _y1;          // The Y coordinates of the first Points of the edges.
+    std::vector<CordType> _x2;          // The X coordinates of the second Points of the edges.
+    std::vector<CordType> _y2;          // The Y coordinates of the second Points of the edges.
+    std::vector<CordType> _a;           // The X coefficients of the lines of the edges.
+    std::vector<CordType> _b;           // The Y coefficients of the lines of the edges.
+    std::vector<CordType> _c;           // The constant coefficients of the lines of the edges.
+    std::vector<ShapeIndex> _owners;    // The index of the Shape of every edge.
+};
+
+
+#endif
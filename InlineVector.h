@@ -0,0 +1,143 @@
+/**
+ * @file InlineVector.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header File for the InlineVector Template.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the InlineVector Template.
+ * Declaring and defining the InlineVector Template, it's methods and fields.
+ * An InlineVector holds up to a fixed amount of values inside the object itself, so it never
+ * allocates memory, and copying it copies only it's bytes. It is used for the Vertices and the
+ * edges of a Shape, which have a small known largest amount.
+ */
+
+
+#ifndef INLINEVECTOR_H
+#define INLINEVECTOR_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+
+/*-----=  Class Definitions  =-----*/
+
+
+/**
+ * @brief A Template Class representing a Vector of at most N values of type T, which keeps the
+ *        values inside the object. T must be trivially copyable, so the values are never
+ *        destroyed and the object can be copied or moved as plain bytes.
+ */
+template <typename T, size_t N>
+class InlineVector
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "An InlineVector holds only trivially copyable values.");
+
+public:
+
+    /**
+     * @brief The type of the values in the Vector.
+     */
+    typedef T value_type;
+
+    /**
+     * @brief An iterator of the values in the Vector.
+     */
+    typedef T *iterator;
+
+    /**
+     * @brief A const iterator of the values in the Vector.
+     */
+    typedef const T *const_iterator;
+
+    /**
+     * @brief A Constructor for the InlineVector, which creates an empty Vector.
+     */
+    InlineVector() : _size(0)
+    {
+
+    };
+
+    /**
+     * @brief Returns the amount of values in the Vector.
+     * @return The amount of values in the Vector.
+     */
+    size_t size() const { return _size; };
+
+    /**
+     * @brief Determine if the Vector holds no values.
+     * @return true if the Vector is empty, false otherwise.
+     */
+    bool empty() const { return _size == 0; };
+
+    /**
+     * @brief Determine if the Vector holds N values, so no more values can be added.
+     * @return true if the Vector is full, false otherwise.
+     */
+    bool full() const { return _size == N; };
+
+    /**
+     * @brief Add the given value to the end of the Vector. The Vector must not be full.
+     * @param value The value to add.
+     */
+    void push_back(const T& value)
+    {
+        new (&_values[_size]) T(value);
+        _size++;
+    };
+
+    /**
+     * @brief Remove all the values from the Vector.
+     */
+    void clear() { _size = 0; };
+
+    /**
+     * @brief Returns the value in the given index.
+     * @param index The index of the value.
+     * @return The value in the index.
+     */
+    const T& operator[](size_t const index) const { return begin()[index]; };
+
+    /**
+     * @brief Returns an iterator to the first value in the Vector.
+     * @return An iterator to the first value.
+     */
+    iterator begin() { return reinterpret_cast<T *>(_values); };
+
+    /**
+     * @brief Returns an iterator after the last value in the Vector.
+     * @return An iterator after the last value.
+     */
+    iterator end() { return begin() + _size; };
+
+    /**
+     * @brief Returns a const iterator to the first value in the Vector.
+     * @return A const iterator to the first value.
+     */
+    const_iterator begin() const { return reinterpret_cast<const T *>(_values); };
+
+    /**
+     * @brief Returns a const iterator after the last value in the Vector.
+     * @return A const iterator after the last value.
+     */
+    const_iterator end() const { return begin() + _size; };
+
+private:
+    // InlineVector Private Fields.
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type _values[N];  // The values.
+    size_t _size;                                                           // The amount of values.
+};
+
+
+#endif
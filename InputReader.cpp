@@ -0,0 +1,264 @@
+/**
+ * @file InputReader.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A File for the InputReader Class implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the InputReader Class implementation.
+ * Define the InputReader Class, it's methods and fields.
+ * An InputReader class reads an input file line by line without copying the lines.
+ * A regular file is mapped to memory, and every line is a span which points straight into the
+ * mapped pages. Other inputs, e.g. pipes, are read with read() into a buffer, and every line is
+ * a span which points into the buffer.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "InputReader.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def NO_DESCRIPTOR -1
+ * @brief A Macro that sets the value of a file descriptor when there is no input.
+ */
+#define NO_DESCRIPTOR -1
+
+/**
+ * @def READ_BUFFER_SIZE 65536
+ * @brief A Macro that sets the initial size of the buffer for an input which is not mapped.
+ */
+#define READ_BUFFER_SIZE 65536
+
+/**
+ * @def NEW_LINE '\n'
+ * @brief A Macro that sets the character which separates the lines of the input.
+ */
+#define NEW_LINE '\n'
+
+
+/*-----=  InputReader Constructors & Destructors  =-----*/
+
+
+/**
+ * @brief A Constructor for the InputReader, which creates a reader with no input.
+ */
+InputReader::InputReader() : _descriptor(NO_DESCRIPTOR), _mapped(nullptr), _mappedSize(0),
+                             _position(0), _bufferBegin(0), _bufferEnd(0), _endOfInput(false)
+{
+
+}
+
+/**
+ * @brief The Destructor for the InputReader Class, which closes the input.
+ */
+InputReader::~InputReader()
+{
+    _close();
+}
+
+
+/*-----=  InputReader Methods  =-----*/
+
+
+/**
+ * @brief Close the input and free the mapped pages.
+ */
+void InputReader::_close()
+{
+    if (_mapped != nullptr)
+    {
+        munmap((void *) _mapped, _mappedSize);
+        _mapped = nullptr;
+    }
+    if (_descriptor != NO_DESCRIPTOR)
+    {
+        close(_descriptor);
+        _descriptor = NO_DESCRIPTOR;
+    }
+}
+
+/**
+ * @brief Prepare the reading of the opened file descriptor. A regular file is mapped to memory,
+ *        and any other file is read with read() into a buffer.
+ * @return true if there is an opened file descriptor, false otherwise.
+ */
+bool InputReader::_prepareInput()
+{
+    if (_descriptor == NO_DESCRIPTOR)
+    {
+        return false;
+    }
+
+    struct stat status;
+    if (fstat(_descriptor, &status) == 0 && S_ISREG(status.st_mode) && status.st_size > 0)
+    {
+        void *pages = mmap(nullptr, (size_t) status.st_size, PROT_READ, MAP_PRIVATE, _descriptor,
+                           0);
+        if (pages != MAP_FAILED)
+        {
+            // The file is read once from start to end, so the kernel may read ahead
+            // aggressively and drop the pages we already passed.
+            madvise(pages, (size_t) status.st_size, MADV_SEQUENTIAL);
+            _mapped = (const char *) pages;
+            _mappedSize = (size_t) status.st_size;
+            return true;
+        }
+    }
+
+    // In case the file can not be mapped (e.g. a pipe) we read it into a buffer.
+    _buffer.resize(READ_BUFFER_SIZE);
+    return true;
+}
+
+/**
+ * @brief Open the file in the given path. A regular file is mapped to memory, and any other
+ *        file is read with read() into a buffer.
+ * @param path The path of the file to read.
+ * @return true if the file was opened successfully, false otherwise.
+ */
+bool InputReader::open(const char *path)
+{
+    _close();
+    _descriptor = ::open(path, O_RDONLY);
+    return _prepareInput();
+}
+
+/**
+ * @brief Open the standard input. A redirected regular file is mapped to memory, and any other
+ *        input (e.g. a pipe) is read with read() into a buffer, as soon as it arrives.
+ * @return true if the standard input was opened successfully, false otherwise.
+ */
+bool InputReader::openStandardInput()
+{
+    _close();
+    _descriptor = dup(STDIN_FILENO);
+    return _prepareInput();
+}
+
+/**
+ * @brief Read more characters from the input into the buffer, keeping the characters that
+ *        were not returned yet. The buffer grows if a line does not fit in it.
+ * @return true if any characters were read, false otherwise.
+ */
+bool InputReader::_fillBuffer()
+{
+    if (_endOfInput || _descriptor == NO_DESCRIPTOR)
+    {
+        return false;
+    }
+
+    // Move the beginning of the current line to the start of the buffer.
+    size_t kept = _bufferEnd - _bufferBegin;
+    memmove(_buffer.data(), _buffer.data() + _bufferBegin, kept);
+    _bufferBegin = 0;
+    _bufferEnd = kept;
+    if (_bufferEnd == _buffer.size())
+    {
+        _buffer.resize(_buffer.size() * 2);
+    }
+
+    ssize_t count;
+    do
+    {
+        count = read(_descriptor, _buffer.data() + _bufferEnd, _buffer.size() - _bufferEnd);
+    } while (count < 0 && errno == EINTR);
+
+    if (count <= 0)
+    {
+        // Like std::getline, an error while reading ends the input.
+        _endOfInput = true;
+        return false;
+    }
+    _bufferEnd += (size_t) count;
+    return true;
+}
+
+/**
+ * @brief Read the next line of the input, without the new line character.
+ *        Like std::getline, the last line is returned even if it does not end with a new line.
+ * @param line The span which will point to the line.
+ * @return true if a line was read, false if the input ended.
+ */
+bool InputReader::nextLine(LineSpan& line)
+{
+    if (_mapped != nullptr)
+    {
+        if (_position >= _mappedSize)
+        {
+            return false;
+        }
+        const char *begin = _mapped + _position;
+        const char *end = (const char *) memchr(begin, NEW_LINE, _mappedSize - _position);
+        size_t length = end != nullptr ? (size_t) (end - begin) : _mappedSize - _position;
+
+        line.begin = begin;
+        line.length = length;
+        _position += length + 1;
+        return true;
+    }
+
+    size_t searched = _bufferBegin;
+    while (true)
+    {
+        const char *begin = _buffer.data() + _bufferBegin;
+        const char *end = (const char *) memchr(_buffer.data() + searched, NEW_LINE,
+                                                _bufferEnd - searched);
+        if (end != nullptr)
+        {
+            line.begin = begin;
+            line.length = (size_t) (end - begin);
+            _bufferBegin += line.length + 1;
+            return true;
+        }
+
+        // The line continues after the buffer, so we read more of it.
+        searched = _bufferEnd - _bufferBegin;
+        if (!_fillBuffer())
+        {
+            if (_bufferBegin == _bufferEnd)
+            {
+                return false;
+            }
+            line.begin = _buffer.data() + _bufferBegin;
+            line.length = _bufferEnd - _bufferBegin;
+            _bufferBegin = _bufferEnd;
+            return true;
+        }
+    }
+}
+
+/**
+ * @brief Returns all the lines of a mapped input which were not read yet, as a single span.
+ *        The lines are not consumed, and the span is valid until the input is closed.
+ * @param input The span which will point to the remaining lines.
+ * @return true if the input is mapped to memory, false otherwise.
+ */
+bool InputReader::getMappedInput(LineSpan& input) const
+{
+    if (_mapped == nullptr)
+    {
+        return false;
+    }
+    size_t position = std::min(_position, _mappedSize);
+    input.begin = _mapped + position;
+    input.length = _mappedSize - position;
+    return true;
+}
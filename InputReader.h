@@ -0,0 +1,131 @@
+/**
+ * @file InputReader.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header File for the InputReader Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the InputReader Class.
+ * Declaring the InputReader Class, it's methods and fields.
+ * An InputReader class reads an input file line by line without copying the lines.
+ * A regular file is mapped to memory, and every line is a span which points straight into the
+ * mapped pages. Other inputs, e.g. pipes, are read with read() into a buffer, and every line is
+ * a span which points into the buffer.
+ */
+
+
+#ifndef INPUTREADER_H
+#define INPUTREADER_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cstddef>
+#include <vector>
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief A Struct representing a span of characters, i.e. a part of the input which is not
+ *        copied. A span is valid until the next line is read.
+ */
+struct LineSpan
+{
+    const char *begin;  // The first character in the span.
+    size_t length;      // The amount of characters in the span.
+};
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class representing a reader of an input file, which returns the lines of the file
+ *        as spans without copying them.
+ */
+class InputReader
+{
+public:
+
+    /**
+     * @brief A Constructor for the InputReader, which creates a reader with no input.
+     */
+    InputReader();
+
+    /**
+     * @brief The Destructor for the InputReader Class, which closes the input.
+     */
+    ~InputReader();
+
+    /**
+     * @brief Open the file in the given path. A regular file is mapped to memory, and any other
+     *        file is read with read() into a buffer.
+     * @param path The path of the file to read.
+     * @return true if the file was opened successfully, false otherwise.
+     */
+    bool open(const char *path);
+
+    /**
+     * @brief Open the standard input. A redirected regular file is mapped to memory, and any other
+     *        input (e.g. a pipe) is read with read() into a buffer, as soon as it arrives.
+     * @return true if the standard input was opened successfully, false otherwise.
+     */
+    bool openStandardInput();
+
+    /**
+     * @brief Read the next line of the input, without the new line character.
+     *        Like std::getline, the last line is returned even if it does not end with a new line.
+     * @param line The span which will point to the line.
+     * @return true if a line was read, false if the input ended.
+     */
+    bool nextLine(LineSpan& line);
+
+    /**
+     * @brief Returns all the lines of a mapped input which were not read yet, as a single span.
+     *        The lines are not consumed, and the span is valid until the input is closed.
+     * @param input The span which will point to the remaining lines.
+     * @return true if the input is mapped to memory, false otherwise.
+     */
+    bool getMappedInput(LineSpan& input) const;
+
+private:
+    // InputReader Private Fields.
+    int _descriptor;             // The file descriptor of the input, or -1 if there is no input.
+    const char *_mapped;         // The mapped pages of a regular file, or NULL if not mapped.
+    size_t _mappedSize;          // The size of the mapped file.
+    size_t _position;            // The position of the next line in the mapped file.
+    std::vector<char> _buffer;   // The buffer for an input which is not mapped.
+    size_t _bufferBegin;         // The position of the next line in the buffer.
+    size_t _bufferEnd;           // The position after the last character read into the buffer.
+    bool _endOfInput;            // true if read() reached the end of the input.
+
+    /**
+     * @brief Close the input and free the mapped pages.
+     */
+    void _close();
+
+    /**
+     * @brief Prepare the reading of the opened file descriptor. A regular file is mapped to memory,
+     *        and any other file is read with read() into a buffer.
+     * @return true if there is an opened file descriptor, false otherwise.
+     */
+    bool _prepareInput();
+
+    /**
+     * @brief Read more characters from the input into the buffer, keeping the characters that
+     *        were not returned yet. The buffer grows if a line does not fit in it.
+     * @return true if any characters were read, false otherwise.
+     */
+    bool _fillBuffer();
+};
+
+
+#endif
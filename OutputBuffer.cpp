@@ -0,0 +1,122 @@
+/**
+ * @file OutputBuffer.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A File for the OutputBuffer Class implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the OutputBuffer Class implementation.
+ * Define the OutputBuffer Class, it's methods and fields.
+ * The buffer is written to the stream only when there is no room for the longest item, so a
+ * long list of pairs costs a single call to the stream for every block.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include "OutputBuffer.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def OUTPUT_BUFFER_SIZE 65536
+ * @brief A Macro that sets the amount of characters which the buffer holds before it is written.
+ */
+#define OUTPUT_BUFFER_SIZE 65536
+
+/**
+ * @def MAX_INDEX_DIGITS 20
+ * @brief A Macro that sets the largest amount of decimal digits of an index.
+ */
+#define MAX_INDEX_DIGITS 20
+
+/**
+ * @def DECIMAL_BASE 10
+ * @brief A Macro that sets the base of the written indices.
+ */
+#define DECIMAL_BASE 10
+
+
+/*-----=  Constructors & Destructors  =-----*/
+
+
+/**
+ * @brief A Constructor for the OutputBuffer, which creates an empty buffer of the given
+ *        stream.
+ * @param stream The stream which the buffer is written to.
+ */
+OutputBuffer::OutputBuffer(std::ostream& stream) : _stream(stream), _buffer(OUTPUT_BUFFER_SIZE),
+                                                   _used(0)
+{
+
+}
+
+/**
+ * @brief The Destructor for the OutputBuffer Class, which writes what is left in the buffer.
+ */
+OutputBuffer::~OutputBuffer()
+{
+    flush();
+}
+
+
+/*-----=  OutputBuffer Methods  =-----*/
+
+
+/**
+ * @brief Add the given character to the end of the buffer.
+ * @param character The character to add.
+ */
+void OutputBuffer::write(char const character)
+{
+    if (_used == _buffer.size())
+    {
+        flush();
+    }
+    _buffer[_used++] = character;
+}
+
+/**
+ * @brief Add the given index to the end of the buffer, in decimal digits.
+ * @param index The index to add.
+ */
+void OutputBuffer::writeIndex(size_t index)
+{
+    if (_buffer.size() - _used < MAX_INDEX_DIGITS)
+    {
+        flush();
+    }
+
+    // The digits are found from the last one, so they are kept aside and then copied in order.
+    char digits[MAX_INDEX_DIGITS];
+    size_t count = 0;
+    do
+    {
+        digits[count++] = (char) ('0' + index % DECIMAL_BASE);
+        index /= DECIMAL_BASE;
+    } while (index > 0);
+    while (count > 0)
+    {
+        _buffer[_used++] = digits[--count];
+    }
+}
+
+/**
+ * @brief Write all the characters in the buffer to the stream, and empty the buffer.
+ */
+void OutputBuffer::flush()
+{
+    if (_used > 0)
+    {
+        _stream.write(_buffer.data(), _used);
+        _used = 0;
+    }
+}
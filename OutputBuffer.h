@@ -0,0 +1,85 @@
+/**
+ * @file OutputBuffer.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header File for the OutputBuffer Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the OutputBuffer Class.
+ * Declaring the OutputBuffer Class, it's methods and fields.
+ * An OutputBuffer class gathers a long output in a large buffer of characters, and writes the
+ * whole buffer to it's stream at once whenever it is full. Indices are written as decimal digits
+ * straight into the buffer, without the formatting of the stream.
+ */
+
+
+#ifndef OUTPUTBUFFER_H
+#define OUTPUTBUFFER_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class representing a buffer of an output stream, which writes to the stream in large
+ *        blocks.
+ */
+class OutputBuffer
+{
+public:
+
+    /**
+     * @brief A Constructor for the OutputBuffer, which creates an empty buffer of the given
+     *        stream.
+     * @param stream The stream which the buffer is written to.
+     */
+    OutputBuffer(std::ostream& stream);
+
+    /**
+     * @brief The Destructor for the OutputBuffer Class, which writes what is left in the buffer.
+     */
+    ~OutputBuffer();
+
+    /**
+     * @brief Add the given character to the end of the buffer.
+     * @param character The character to add.
+     */
+    void write(char const character);
+
+    /**
+     * @brief Add the given index to the end of the buffer, in decimal digits.
+     * @param index The index to add.
+     */
+    void writeIndex(size_t index);
+
+    /**
+     * @brief Write all the characters in the buffer to the stream, and empty the buffer.
+     */
+    void flush();
+
+private:
+    // OutputBuffer Private Fields.
+    std::ostream& _stream;      // The stream which the buffer is written to.
+    std::vector<char> _buffer;  // The characters which were not written yet.
+    size_t _used;               // The amount of characters in the buffer.
+
+    // A buffer writes to it's stream, so it is never copied.
+    OutputBuffer(const OutputBuffer& other) = delete;
+    OutputBuffer& operator=(const OutputBuffer& other) = delete;
+};
+
+
+#endif
@@ -0,0 +1,128 @@
+/**
+ * @file Parallel.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A File for the Parallel helpers implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the Parallel helpers implementation.
+ * The Parallel helpers split a range of work items between several worker threads, where each
+ * thread receives one continuous part of the range.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "Parallel.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def MIN_THREADS 1
+ * @brief A Macro that sets the smallest amount of worker threads.
+ */
+#define MIN_THREADS 1
+
+
+/*-----=  Parallel Methods  =-----*/
+
+
+/**
+ * @brief Returns the amount of worker threads to use, which is the amount of cores available.
+ * @return The amount of worker threads to use, at least 1.
+ */
+ThreadCount getThreadCount()
+{
+    ThreadCount cores = std::thread::hardware_concurrency();
+    return cores < MIN_THREADS ? MIN_THREADS : cores;
+}
+
+/**
+ * @brief Split the work items in the range [0, count) to continuous parts, and run the given job
+ *        on every part in it's own worker thread. The function returns after all the parts are
+ *        done. The parts are given to the threads in order, i.e. thread 0 gets the first part.
+ * @param count The amount of work items.
+ * @param threads The amount of worker threads to use.
+ * @param job The job to run on every part.
+ */
+void parallelFor(size_t count, ThreadCount threads, const RangeJob& job)
+{
+    if (threads <= MIN_THREADS || count <= MIN_THREADS)
+    {
+        // There is no point in starting a thread for a single part.
+        job(0, count, 0);
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (ThreadCount thread = 1; thread < threads; thread++)
+    {
+        size_t begin = (count * thread) / threads;
+        size_t end = (count * (thread + 1)) / threads;
+        workers.push_back(std::thread(job, begin, end, thread));
+    }
+
+    // The calling thread handles the first part by itself.
+    job(0, count / threads, 0);
+
+    for (auto i = workers.begin(); i != workers.end(); i++)
+    {
+        i -> join();
+    }
+}
+
+/**
+ * @brief Split the work items in the range [0, count) to blocks of the given size, and run the
+ *        given job on the blocks using several worker threads. The blocks are given out in their
+ *        order, and a thread which finished a block takes the next block which was not taken yet,
+ *        so the early work items are always handled before the later ones.
+ * @param count The amount of work items.
+ * @param blockSize The amount of work items in a block.
+ * @param threads The amount of worker threads to use.
+ * @param job The job to run on every block.
+ */
+void parallelForBlocks(size_t count, size_t blockSize, ThreadCount threads, const RangeJob& job)
+{
+    if (threads <= MIN_THREADS || count <= blockSize)
+    {
+        job(0, count, 0);
+        return;
+    }
+
+    std::atomic<size_t> nextBlock(0);
+    auto worker = [count, blockSize, &job, &nextBlock](ThreadCount thread)
+    {
+        size_t begin;
+        while ((begin = nextBlock.fetch_add(blockSize, std::memory_order_relaxed)) < count)
+        {
+            job(begin, std::min(begin + blockSize, count), thread);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (ThreadCount thread = 1; thread < threads; thread++)
+    {
+        workers.push_back(std::thread(worker, thread));
+    }
+
+    // The calling thread takes blocks like any other worker.
+    worker(0);
+
+    for (auto i = workers.begin(); i != workers.end(); i++)
+    {
+        i -> join();
+    }
+}
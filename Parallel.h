@@ -0,0 +1,120 @@
+/**
+ * @file Parallel.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header File for the Parallel helpers.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Parallel helpers.
+ * The Parallel helpers split a range of work items between several worker threads, where each
+ * thread receives one continuous part of the range.
+ */
+
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include <functional>
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief ThreadCount is an unsigned int which holds an amount of worker threads.
+ */
+typedef unsigned int ThreadCount;
+
+/**
+ * @brief RangeJob is a job that handles the work items in the range [begin, end) as the worker
+ *        thread with the given thread number.
+ */
+typedef std::function<void(size_t begin, size_t end, ThreadCount thread)> RangeJob;
+
+
+/*-----=  Parallel Methods  =-----*/
+
+
+/**
+ * @brief Returns the amount of worker threads to use, which is the amount of cores available.
+ * @return The amount of worker threads to use, at least 1.
+ */
+ThreadCount getThreadCount();
+
+/**
+ * @brief Split the work items in the range [0, count) to continuous parts, and run the given job
+ *        on every part in it's own worker thread. The function returns after all the parts are
+ *        done. The parts are given to the threads in order, i.e. thread 0 gets the first part.
+ * @param count The amount of work items.
+ * @param threads The amount of worker threads to use.
+ * @param job The job to run on every part.
+ */
+void parallelFor(size_t count, ThreadCount threads, const RangeJob& job);
+
+/**
+ * @brief Split the work items in the range [0, count) to blocks of the given size, and run the
+ *        given job on the blocks using several worker threads. The blocks are given out in their
+ *        order, and a thread which finished a block takes the next block which was not taken yet,
+ *        so the early work items are always handled before the later ones.
+ * @param count The amount of work items.
+ * @param blockSize The amount of work items in a block.
+ * @param threads The amount of worker threads to use.
+ * @param job The job to run on every block.
+ */
+void parallelForBlocks(size_t count, size_t blockSize, ThreadCount threads, const RangeJob& job);
+
+/**
+ * @brief Sort the items in the range [begin, end) of the given Vector using several worker
+ *        threads. Every thread sorts one continuous part of the range, and then the sorted parts
+ *        are merged together.
+ * @param items The Vector which holds the items to sort.
+ * @param begin The position of the first item to sort.
+ * @param end The position after the last item to sort.
+ * @param threads The amount of worker threads to use.
+ * @param compare The comparison which determines the order of the items.
+ */
+template <typename Item, typename Compare>
+void parallelSort(std::vector<Item>& items, size_t begin, size_t end, ThreadCount threads,
+                  Compare compare)
+{
+    size_t count = end - begin;
+    if (threads > count)
+    {
+        threads = count > 0 ? (ThreadCount) count : 1;
+    }
+
+    // Sort every part, where part number t is [begin + count * t / threads, ...).
+    parallelFor(count, threads, [&items, begin, &compare](size_t first, size_t last, ThreadCount)
+    {
+        std::sort(items.begin() + begin + first, items.begin() + begin + last, compare);
+    });
+
+    // Merge neighbouring parts, doubling the size of the sorted parts on every round.
+    for (ThreadCount width = 1; width < threads; width *= 2)
+    {
+        for (ThreadCount part = 0; part + width < threads; part += 2 * width)
+        {
+            ThreadCount lastPart = std::min(part + 2 * width, threads);
+            size_t first = begin + (count * part) / threads;
+            size_t middle = begin + (count * (part + width)) / threads;
+            size_t last = begin + (count * lastPart) / threads;
+            std::inplace_merge(items.begin() + first, items.begin() + middle,
+                               items.begin() + last, compare);
+        }
+    }
+}
+
+
+#endif
@@ -0,0 +1,454 @@
+/**
+ * @file PointLocator.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A File for the PointLocator Class implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the PointLocator Class implementation.
+ * Define the PointLocator Class, it's methods and fields.
+ * A slab at every distinct Y value of the Shapes would keep a tall Shape in very many slabs, so
+ * the slabs are joined in pairs until every Shape crosses only a few slabs on average. Inside a
+ * slab the entries are sorted by their smallest X value, and every entry keeps the largest X
+ * value of the entries before it, so the search inside a slab stops as soon as no earlier entry
+ * can reach the Point.
+ * The containment kernel is chosen when the program runs: AVX2 checks all the edges of a Shape
+ * in an instruction, SSE2 checks 2 edges, and on other machines the edges are checked one by
+ * one. Every kernel calculates the line values with the same products and sums in the same
+ * order as the line of an edge does, so all the kernels give the same results.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include "PointLocator.h"
+#include "Parallel.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define X86_VECTOR_KERNELS
+#endif
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def MAX_SLAB_COPIES 4
+ * @brief A Macro that sets the largest average amount of slabs which a Shape crosses.
+ */
+#define MAX_SLAB_COPIES 4
+
+/**
+ * @def SLAB_BLOCK_SIZE 256
+ * @brief A Macro that sets the amount of slabs which a worker thread sorts at once.
+ */
+#define SLAB_BLOCK_SIZE 256
+
+/**
+ * @def SLAB_JOIN_STEP 2
+ * @brief A Macro that sets the amount of neighbouring slabs which are joined to a single slab
+ *        when the Shapes cross too many slabs.
+ */
+#define SLAB_JOIN_STEP 2
+
+/**
+ * @def ALL_SIDES_MASK ((1u << MAX_SHAPE_VERTICES) - 1)
+ * @brief A Macro that sets the set of sides of a Point which is on the right side of all the
+ *        edges of a Shape.
+ */
+#define ALL_SIDES_MASK ((1u << MAX_SHAPE_VERTICES) - 1)
+
+/**
+ * @def SSE2_LANES 2
+ * @brief A Macro that sets the amount of edges which an SSE2 instruction checks.
+ */
+#define SSE2_LANES 2
+
+/**
+ * @def AVX2_LANES 4
+ * @brief A Macro that sets the amount of edges which an AVX2 instruction checks.
+ */
+#define AVX2_LANES 4
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief ContainmentKernel is a method which determines if the given Point appears on the same
+ *        side of all the given edges of a Shape.
+ */
+typedef bool (*ContainmentKernel)(const ConvexEdges& edges, CordType const x, CordType const y);
+
+
+/*-----=  Containment Kernels  =-----*/
+
+
+/**
+ * @brief Determine if the given set of sides of a Point holds the same side for all the edges.
+ * @param sides The side of the Point according to every edge, where a set bit stands for the
+ *        right side.
+ * @return true if the Point is on the same side of all the edges, false otherwise.
+ */
+static inline bool isSameSide(unsigned int const sides)
+{
+    return sides == 0 || sides == ALL_SIDES_MASK;
+}
+
+/**
+ * @brief Determine if the given Point appears on the same side of all the given edges, checking
+ *        the edges one by one.
+ * @param edges The lines of the edges of the Shape.
+ * @param x The X coordinate of the Point.
+ * @param y The Y coordinate of the Point.
+ * @return true if the Point is inside the Shape, false otherwise.
+ */
+static bool containsScalar(const ConvexEdges& edges, CordType const x, CordType const y)
+{
+    unsigned int sides = 0;
+    for (ShapeSize i = 0; i < MAX_SHAPE_VERTICES; i++)
+    {
+        // True for right-side, false for left-side.
+        sides |= (unsigned int) ((edges.a[i] * x) + (edges.b[i] * y) + edges.c[i] < 0) << i;
+    }
+    return isSameSide(sides);
+}
+
+#ifdef X86_VECTOR_KERNELS
+
+/**
+ * @brief Determine if the given Point appears on the same side of all the given edges, checking
+ *        2 edges in every SSE2 instruction.
+ * @param edges The lines of the edges of the Shape.
+ * @param x The X coordinate of the Point.
+ * @param y The Y coordinate of the Point.
+ * @return true if the Point is inside the Shape, false otherwise.
+ */
+__attribute__((target("sse2")))
+static bool containsSse2(const ConvexEdges& edges, CordType const x, CordType const y)
+{
+    const __m128d zero = _mm_setzero_pd();
+    const __m128d pointX = _mm_set1_pd(x);
+    const __m128d pointY = _mm_set1_pd(y);
+
+    unsigned int sides = 0;
+    for (ShapeSize i = 0; i < MAX_SHAPE_VERTICES; i += SSE2_LANES)
+    {
+        __m128d values = _mm_add_pd(_mm_add_pd(_mm_mul_pd(_mm_loadu_pd(edges.a + i), pointX),
+                                               _mm_mul_pd(_mm_loadu_pd(edges.b + i), pointY)),
+                                    _mm_loadu_pd(edges.c + i));
+        sides |= (unsigned int) _mm_movemask_pd(_mm_cmplt_pd(values, zero)) << i;
+    }
+    return isSameSide(sides);
+}
+
+/**
+ * @brief Determine if the given Point appears on the same side of all the given edges, checking
+ *        4 edges in every AVX2 instruction.
+ * @param edges The lines of the edges of the Shape.
+ * @param x The X coordinate of the Point.
+ * @param y The Y coordinate of the Point.
+ * @return true if the Point is inside the Shape, false otherwise.
+ */
+__attribute__((target("avx2")))
+static bool containsAvx2(const ConvexEdges& edges, CordType const x, CordType const y)
+{
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d pointX = _mm256_set1_pd(x);
+    const __m256d pointY = _mm256_set1_pd(y);
+
+    unsigned int sides = 0;
+    for (ShapeSize i = 0; i < MAX_SHAPE_VERTICES; i += AVX2_LANES)
+    {
+        __m256d values = _mm256_add_pd(
+                _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(edges.a + i), pointX),
+                              _mm256_mul_pd(_mm256_loadu_pd(edges.b + i), pointY)),
+                _mm256_loadu_pd(edges.c + i));
+        sides |= (unsigned int) _mm256_movemask_pd(_mm256_cmp_pd(values, zero, _CMP_LT_OQ)) << i;
+    }
+    return isSameSide(sides);
+}
+
+#endif
+
+/**
+ * @brief Choose the fastest kernel which the machine that runs the program supports.
+ * @return The chosen kernel.
+ */
+static ContainmentKernel chooseKernel()
+{
+#ifdef X86_VECTOR_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && MAX_SHAPE_VERTICES % AVX2_LANES == 0)
+    {
+        return containsAvx2;
+    }
+    if (__builtin_cpu_supports("sse2") && MAX_SHAPE_VERTICES % SSE2_LANES == 0)
+    {
+        return containsSse2;
+    }
+#endif
+    return containsScalar;
+}
+
+
+/*-----=  Slab Helpers  =-----*/
+
+
+/**
+ * @brief Determine if the given Bounding Box can be placed in the slabs, i.e. none of it's
+ *        values is not a number.
+ * @param box The Bounding Box to check.
+ * @return true if the Bounding Box can be placed in the slabs, false otherwise.
+ */
+static inline bool isOrdered(const BoundingBox& box)
+{
+    return box.getMinX() <= box.getMaxX() && box.getMinY() <= box.getMaxY();
+}
+
+/**
+ * @brief Determine if the first given entry comes before the second given entry in a slab, i.e.
+ *        it has a smaller X value, or the same X value and a smaller Shape index.
+ * @param first The first entry.
+ * @param second The second entry.
+ * @return true if the first entry comes before the second entry, false otherwise.
+ */
+static bool isEntryBefore(const SlabEntry& first, const SlabEntry& second)
+{
+    if (first.minX != second.minX)
+    {
+        return first.minX < second.minX;
+    }
+    return first.shape < second.shape;
+}
+
+/**
+ * @brief Determine if the given X value is before the given entry, i.e. the entry starts to the
+ *        right of the value.
+ * @param x The X value.
+ * @param entry The entry.
+ * @return true if the value is smaller than the smallest X value of the entry, false otherwise.
+ */
+static bool isBeforeEntry(CordType const x, const SlabEntry& entry)
+{
+    return x < entry.minX;
+}
+
+
+/*-----=  PointLocator Constructors  =-----*/
+
+
+/**
+ * @brief A Constructor for the PointLocator, which creates a locator with no Shapes.
+ */
+PointLocator::PointLocator()
+{
+
+}
+
+
+/*-----=  PointLocator Methods  =-----*/
+
+
+/**
+ * @brief Returns the slab which contains the given Y value.
+ * @param y The Y value.
+ * @return The index of the slab, or the amount of slabs if the value is below all of them.
+ */
+size_t PointLocator::_getSlab(CordType const y) const
+{
+    auto slab = std::upper_bound(_bounds.begin(), _bounds.end(), y);
+    return slab == _bounds.begin() ? _bounds.size() : (size_t) (slab - _bounds.begin()) - 1;
+}
+
+/**
+ * @brief Count the entries of all the slabs, where every Shape has an entry in every slab
+ *        which it's Bounding Box crosses.
+ * @param shapes The Shapes of the locator.
+ * @return The amount of entries.
+ */
+size_t PointLocator::_countEntries(const ShapeStore& shapes) const
+{
+    size_t count = 0;
+    for (ShapeIndex i = 0; i < shapes.size(); i++)
+    {
+        const BoundingBox& box = shapes.getBoundingBox(i);
+        if (isOrdered(box))
+        {
+            count += _getSlab(box.getMaxY()) - _getSlab(box.getMinY()) + 1;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Build the slabs of the locator over all the given Shapes. The slabs are cut at the
+ *        smallest Y values of the Shapes, and are joined until every Shape crosses only a few
+ *        slabs on average. The entries of every slab are sorted using all the worker threads.
+ * @param shapes The Shapes to locate the Points in.
+ */
+void PointLocator::build(const ShapeStore& shapes)
+{
+    ShapeIndex count = shapes.size();
+    ThreadCount threads = getThreadCount();
+
+    // The edges of every Shape are kept as columns for the containment kernel.
+    _edges.resize(count);
+    for (ShapeIndex i = 0; i < count; i++)
+    {
+        ShapeView shape = shapes.getShape(i);
+        for (ShapeSize k = 0; k < MAX_SHAPE_VERTICES; k++)
+        {
+            const EdgeLine& line = shape.getEdge(k < shape.getVertexCount() ? k : 0);
+            _edges[i].a[k] = line.a;
+            _edges[i].b[k] = line.b;
+            _edges[i].c[k] = line.c;
+        }
+    }
+
+    // Cut a slab at every distinct smallest Y value, and join the slabs in pairs while the
+    // Shapes cross too many slabs. The lowest bound is always kept.
+    _bounds.clear();
+    for (ShapeIndex i = 0; i < count; i++)
+    {
+        const BoundingBox& box = shapes.getBoundingBox(i);
+        if (isOrdered(box))
+        {
+            _bounds.push_back(box.getMinY());
+        }
+    }
+    parallelSort(_bounds, 0, _bounds.size(), threads, std::less<CordType>());
+    _bounds.erase(std::unique(_bounds.begin(), _bounds.end()), _bounds.end());
+    while (_bounds.size() > 1 && _countEntries(shapes) > (size_t) MAX_SLAB_COPIES * count)
+    {
+        size_t kept = 0;
+        for (size_t i = 0; i < _bounds.size(); i += SLAB_JOIN_STEP)
+        {
+            _bounds[kept++] = _bounds[i];
+        }
+        _bounds.resize(kept);
+    }
+
+    // Count the entries of every slab, and place the entries of every slab in the order of the
+    // Shapes.
+    size_t slabs = _bounds.size();
+    _firstEntry.assign(slabs + 1, 0);
+    for (ShapeIndex i = 0; i < count; i++)
+    {
+        const BoundingBox& box = shapes.getBoundingBox(i);
+        if (isOrdered(box))
+        {
+            for (size_t s = _getSlab(box.getMinY()); s <= _getSlab(box.getMaxY()); s++)
+            {
+                _firstEntry[s + 1]++;
+            }
+        }
+    }
+    for (size_t s = 0; s < slabs; s++)
+    {
+        _firstEntry[s + 1] += _firstEntry[s];
+    }
+
+    std::vector<size_t> next(_firstEntry.begin(), _firstEntry.end() - 1);
+    _entries.resize(_firstEntry[slabs]);
+    for (ShapeIndex i = 0; i < count; i++)
+    {
+        const BoundingBox& box = shapes.getBoundingBox(i);
+        if (isOrdered(box))
+        {
+            SlabEntry entry = {box.getMinX(), box.getMaxX(), box.getMaxX(), i};
+            for (size_t s = _getSlab(box.getMinY()); s <= _getSlab(box.getMaxY()); s++)
+            {
+                _entries[next[s]++] = entry;
+            }
+        }
+    }
+
+    // Sort every slab by the smallest X values, and find the reach of every entry.
+    parallelForBlocks(slabs, SLAB_BLOCK_SIZE, threads, [this](size_t begin, size_t end, ThreadCount)
+    {
+        for (size_t s = begin; s < end; s++)
+        {
+            auto first = _entries.begin() + _firstEntry[s];
+            auto last = _entries.begin() + _firstEntry[s + 1];
+            std::sort(first, last, isEntryBefore);
+            for (auto i = first; i != last; i++)
+            {
+                i -> reach = i == first ? i -> maxX : std::max((i - 1) -> reach, i -> maxX);
+            }
+        }
+    });
+}
+
+/**
+ * @brief Find the Shape which contains the given Point, i.e. the Point appears on the same
+ *        side of all the edges of the Shape, the same way a Vertex is found inside a Shape.
+ *        If several Shapes contain the Point, the Shape with the smallest index is found.
+ *        Only the Shapes which their Bounding Box contains the Point are checked.
+ * @param shapes The ShapeStore which the locator was built from.
+ * @param x The X coordinate of the Point.
+ * @param y The Y coordinate of the Point.
+ * @return The index of the Shape which contains the Point, or NO_SHAPE if there is none.
+ */
+ShapeIndex PointLocator::locate(const ShapeStore& shapes, CordType const x,
+                                CordType const y) const
+{
+    // The kernel is chosen once, by the first thread which locates a Point.
+    static const ContainmentKernel kernel = chooseKernel();
+
+    size_t slab = _getSlab(y);
+    if (slab == _bounds.size())
+    {
+        return NO_SHAPE;
+    }
+
+    // Walk back from the last entry which starts before the Point, while an entry before the
+    // current entry can still reach the Point.
+    auto first = _entries.begin() + _firstEntry[slab];
+    auto current = std::upper_bound(first, _entries.begin() + _firstEntry[slab + 1], x,
+                                    isBeforeEntry);
+    ShapeIndex found = NO_SHAPE;
+    while (current != first && (current - 1) -> reach >= x)
+    {
+        current--;
+        if (current -> maxX < x || current -> shape >= found)
+        {
+            continue;
+        }
+        const BoundingBox& box = shapes.getBoundingBox(current -> shape);
+        if (box.getMinY() <= y && y <= box.getMaxY() && kernel(_edges[current -> shape], x, y))
+        {
+            found = current -> shape;
+        }
+    }
+    return found;
+}
+
+/**
+ * @brief Find the Shape which contains every given Point, using all the worker threads.
+ * @param shapes The ShapeStore which the locator was built from.
+ * @param points The Points to locate.
+ * @param result The Vector which the index of the Shape of every Point is written to, in the
+ *        order of the Points, where NO_SHAPE stands for a Point that no Shape contains.
+ */
+void PointLocator::locateAll(const ShapeStore& shapes, const std::vector<Point>& points,
+                             std::vector<ShapeIndex>& result) const
+{
+    result.resize(points.size());
+    parallelFor(points.size(), getThreadCount(),
+                [this, &shapes, &points, &result](size_t begin, size_t end, ThreadCount)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            result[i] = locate(shapes, points[i].getX(), points[i].getY());
+        }
+    });
+}
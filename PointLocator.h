@@ -0,0 +1,142 @@
+/**
+ * @file PointLocator.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header File for the PointLocator Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the PointLocator Class.
+ * Declaring the PointLocator Class, it's methods and fields.
+ * A PointLocator class finds the Shape which contains a given Point. The plane is cut to
+ * horizontal slabs, and every slab keeps the Shapes which cross it sorted by their smallest X
+ * value, so a Point is located by a binary search for it's slab and a binary search inside the
+ * slab. The Shapes which are found around the Point are then checked by a containment kernel,
+ * which checks the Point against all the edges of a Shape at once using the vector instructions
+ * of the machine.
+ */
+
+
+#ifndef POINTLOCATOR_H
+#define POINTLOCATOR_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <vector>
+#include "ShapeStore.h"
+#include "Point.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def NO_SHAPE ((ShapeIndex) -1)
+ * @brief A Macro that sets the index which is returned for a Point that no Shape contains.
+ */
+#define NO_SHAPE ((ShapeIndex) -1)
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief A Struct representing the lines of the edges of a single Shape as columns, which the
+ *        containment kernel reads at once. A Shape with fewer than MAX_SHAPE_VERTICES edges
+ *        repeats it's first edge, which does not change the result of the check.
+ */
+struct ConvexEdges
+{
+    CordType a[MAX_SHAPE_VERTICES];     // The X coefficients of the lines of the edges.
+    CordType b[MAX_SHAPE_VERTICES];     // The Y coefficients of the lines of the edges.
+    CordType c[MAX_SHAPE_VERTICES];     // The constant coefficients of the lines of the edges.
+};
+
+/**
+ * @brief A Struct representing a Shape which crosses a slab of the locator.
+ */
+struct SlabEntry
+{
+    CordType minX;      // The smallest X value of the Shape.
+    CordType maxX;      // The largest X value of the Shape.
+    CordType reach;     // The largest X value of this entry and all the entries before it.
+    ShapeIndex shape;   // The index of the Shape.
+};
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class representing a slab decomposition of the plane over a set of Shapes, which
+ *        finds the Shape that contains a given Point.
+ */
+class PointLocator
+{
+public:
+
+    /**
+     * @brief A Constructor for the PointLocator, which creates a locator with no Shapes.
+     */
+    PointLocator();
+
+    /**
+     * @brief Build the slabs of the locator over all the given Shapes. The slabs are cut at the
+     *        smallest Y values of the Shapes, and are joined until every Shape crosses only a few
+     *        slabs on average. The entries of every slab are sorted using all the worker threads.
+     * @param shapes The Shapes to locate the Points in.
+     */
+    void build(const ShapeStore& shapes);
+
+    /**
+     * @brief Find the Shape which contains the given Point, i.e. the Point appears on the same
+     *        side of all the edges of the Shape, the same way a Vertex is found inside a Shape.
+     *        If several Shapes contain the Point, the Shape with the smallest index is found.
+     * @param shapes The ShapeStore which the locator was built from.
+     * @param x The X coordinate of the Point.
+     * @param y The Y coordinate of the Point.
+     * @return The index of the Shape which contains the Point, or NO_SHAPE if there is none.
+     */
+    ShapeIndex locate(const ShapeStore& shapes, CordType const x, CordType const y) const;
+
+    /**
+     * @brief Find the Shape which contains every given Point, using all the worker threads.
+     * @param shapes The ShapeStore which the locator was built from.
+     * @param points The Points to locate.
+     * @param result The Vector which the index of the Shape of every Point is written to, in the
+     *        order of the Points, where NO_SHAPE stands for a Point that no Shape contains.
+     */
+    void locateAll(const ShapeStore& shapes, const std::vector<Point>& points,
+                   std::vector<ShapeIndex>& result) const;
+
+private:
+    // PointLocator Private Fields.
+    std::vector<CordType> _bounds;      // The lowest Y value of every slab, in increasing order.
+    std::vector<size_t> _firstEntry;    // The index of the first entry of every slab.
+    std::vector<SlabEntry> _entries;    // The entries of all the slabs, one slab after the other.
+    std::vector<ConvexEdges> _edges;    // The lines of the edges of every Shape.
+
+    /**
+     * @brief Returns the slab which contains the given Y value.
+     * @param y The Y value.
+     * @return The index of the slab, or the amount of slabs if the value is below all of them.
+     */
+    size_t _getSlab(CordType const y) const;
+
+    /**
+     * @brief Count the entries of all the slabs, where every Shape has an entry in every slab
+     *        which it's Bounding Box crosses.
+     * @param shapes The Shapes of the locator.
+     * @return The amount of entries.
+     */
+    size_t _countEntries(const ShapeStore& shapes) const;
+};
+
+
+#endif
@@ -0,0 +1,558 @@
+/**
+ * @file RTree.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A File for the RTree Class implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the RTree Class implementation.
+ * Define the RTree Class, it's methods and fields.
+ * An RTree class is a tree of Bounding Boxes, where every node holds the Bounding Boxes of it's
+ * children and the leaves hold the Bounding Boxes of the Shapes. The tree is built at once from
+ * all the Shapes using Sort-Tile-Recursive (STR) packing, so every node is full and nodes which
+ * are close in the plane are close in memory. Unlike a uniform grid, the tree adapts to the
+ * input, so it suits inputs where the Shapes are spread unevenly.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <atomic>
+#include <cmath>
+#include <algorithm>
+#include "RTree.h"
+#include "SweepLine.h"
+#include "ShapeKernels.h"
+#include "Parallel.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def ROOT_SIZE 1
+ * @brief A Macro that sets the amount of nodes in the top level of the tree.
+ */
+#define ROOT_SIZE 1
+
+/**
+ * @def TASKS_PER_THREAD 8
+ * @brief A Macro that sets the amount of join tasks which are prepared for every worker thread,
+ *        so threads which received an easy part of the tree will not stay idle.
+ */
+#define TASKS_PER_THREAD 8
+
+/**
+ * @def SEARCH_BLOCK_SIZE 64
+ * @brief A Macro that sets the amount of Shapes which a worker thread takes at once when it
+ *        searches for the first intersection.
+ */
+#define SEARCH_BLOCK_SIZE 64
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief A Struct representing an item that is packed into the nodes of some level of the tree.
+ *        In the lowest level the items are the Shapes, and in every other level they are the
+ *        nodes of the level below.
+ */
+struct PackItem
+{
+    BoundingBox box;   // The Bounding Box of the item.
+    CordType centerX;  // The X value of the center of the Bounding Box.
+    CordType centerY;  // The Y value of the center of the Bounding Box.
+    size_t id;         // The index of the Shape or the node.
+};
+
+/**
+ * @brief PackVector is a Vector of items to pack.
+ */
+typedef std::vector<PackItem> PackVector;
+
+/**
+ * @brief A Struct representing a task of joining the Shapes under two nodes of the tree.
+ */
+struct JoinTask
+{
+    NodeIndex first;   // The first node.
+    NodeIndex second;  // The second node.
+};
+
+
+/*-----=  RTree Helpers  =-----*/
+
+
+/**
+ * @brief Create an item to pack from the given Bounding Box.
+ * @param box The Bounding Box of the item.
+ * @param id The index of the Shape or the node.
+ * @return The item to pack.
+ */
+static PackItem createItem(const BoundingBox& box, size_t const id)
+{
+    return {box, (box.getMinX() + box.getMaxX()) / 2, (box.getMinY() + box.getMaxY()) / 2, id};
+}
+
+/**
+ * @brief Determine if 2 children of the given nodes overlap.
+ * @param a The node of the first child.
+ * @param i The position of the first child in it's node.
+ * @param b The node of the second child.
+ * @param j The position of the second child in it's node.
+ * @return true if the Bounding Boxes of the children overlap, false otherwise.
+ */
+static inline bool childrenOverlap(const RTreeNode& a, unsigned int const i, const RTreeNode& b,
+                                   unsigned int const j)
+{
+    return a.minX[i] <= b.maxX[j] && b.minX[j] <= a.maxX[i] &&
+           a.minY[i] <= b.maxY[j] && b.minY[j] <= a.maxY[i];
+}
+
+/**
+ * @brief Split the join of the root of the given tree with itself into smaller joins of nodes,
+ *        until there are enough tasks for all the worker threads or the tasks reach the leaves.
+ *        Joining all the tasks finds every pair of the whole join once.
+ * @param nodes The nodes of the tree, where the root is the last node.
+ * @param threads The amount of worker threads.
+ * @return The tasks of joining two nodes.
+ */
+static std::vector<JoinTask> splitJoin(const std::vector<RTreeNode>& nodes,
+                                       ThreadCount const threads)
+{
+    std::vector<JoinTask> tasks(ROOT_SIZE, {nodes.size() - 1, nodes.size() - 1});
+    while (tasks.size() < threads * TASKS_PER_THREAD && !nodes[tasks.front().first].leaf)
+    {
+        std::vector<JoinTask> children;
+        for (auto task = tasks.begin(); task != tasks.end(); task++)
+        {
+            const RTreeNode& a = nodes[task -> first];
+            const RTreeNode& b = nodes[task -> second];
+            bool sameNode = task -> first == task -> second;
+            for (unsigned int i = 0; i < a.count; i++)
+            {
+                for (unsigned int j = sameNode ? i : 0; j < b.count; j++)
+                {
+                    if ((sameNode && i == j) || childrenOverlap(a, i, b, j))
+                    {
+                        children.push_back({a.child[i], b.child[j]});
+                    }
+                }
+            }
+        }
+        tasks.swap(children);
+    }
+    return tasks;
+}
+
+/**
+ * @brief Pack the given items into full nodes using Sort-Tile-Recursive: the items are sorted by
+ *        X and cut into vertical slices, and every slice is sorted by Y and cut into nodes.
+ * @param items The items to pack. The items are reordered.
+ * @param leaf true if the items are Shapes.
+ * @param nodes The Vector which the created nodes are added to.
+ * @return The items of the next level, i.e. the created nodes.
+ */
+static PackVector packLevel(PackVector& items, bool const leaf, std::vector<RTreeNode>& nodes)
+{
+    ThreadCount threads = getThreadCount();
+    size_t nodeCount = (items.size() + RTREE_NODE_CAPACITY - 1) / RTREE_NODE_CAPACITY;
+    size_t sliceCount = (size_t) std::ceil(std::sqrt((double) nodeCount));
+    size_t sliceSize = ((nodeCount + sliceCount - 1) / sliceCount) * RTREE_NODE_CAPACITY;
+
+    parallelSort(items, 0, items.size(), threads, [](const PackItem& a, const PackItem& b)
+    {
+        return a.centerX < b.centerX;
+    });
+
+    // Every slice is a multiple of a node in size, so no node crosses between slices.
+    parallelFor(sliceCount, threads, [&items, sliceSize](size_t begin, size_t end, ThreadCount)
+    {
+        for (size_t slice = begin; slice < end; slice++)
+        {
+            size_t first = std::min(slice * sliceSize, items.size());
+            size_t last = std::min(first + sliceSize, items.size());
+            std::sort(items.begin() + first, items.begin() + last,
+                      [](const PackItem& a, const PackItem& b)
+                      {
+                          return a.centerY < b.centerY;
+                      });
+        }
+    });
+
+    size_t firstNode = nodes.size();
+    nodes.resize(firstNode + nodeCount);
+    PackVector parents(nodeCount);
+    parallelFor(nodeCount, threads, [&](size_t begin, size_t end, ThreadCount)
+    {
+        for (size_t n = begin; n < end; n++)
+        {
+            RTreeNode& node = nodes[firstNode + n];
+            BoundingBox box;
+            size_t first = n * RTREE_NODE_CAPACITY;
+            size_t last = std::min(first + RTREE_NODE_CAPACITY, items.size());
+
+            node.count = (unsigned int) (last - first);
+            node.leaf = leaf;
+            for (size_t i = first; i < last; i++)
+            {
+                const BoundingBox& itemBox = items[i].box;
+                unsigned int position = (unsigned int) (i - first);
+                node.minX[position] = itemBox.getMinX();
+                node.minY[position] = itemBox.getMinY();
+                node.maxX[position] = itemBox.getMaxX();
+                node.maxY[position] = itemBox.getMaxY();
+                node.child[position] = items[i].id;
+                box.expand(itemBox);
+            }
+            parents[n] = createItem(box, firstNode + n);
+        }
+    });
+    return parents;
+}
+
+
+/*-----=  RTree Constructors & Destructors  =-----*/
+
+
+/**
+ * @brief A Constructor for the RTree, which creates an empty tree.
+ */
+RTree::RTree()
+{
+
+}
+
+
+/*-----=  RTree Methods  =-----*/
+
+
+/**
+ * @brief Build the tree from all the given Shapes using Sort-Tile-Recursive packing.
+ *        The sorts are done using all the worker threads.
+ * @param shapes The Shapes to hold in the tree.
+ */
+void RTree::build(const ShapeStore& shapes)
+{
+    _nodes.clear();
+    if (shapes.empty())
+    {
+        return;
+    }
+
+    PackVector items;
+    items.reserve(shapes.size());
+    for (ShapeIndex i = 0; i < shapes.size(); i++)
+    {
+        items.push_back(createItem(shapes.getBoundingBox(i), i));
+    }
+
+    // Every level packs the level below it, until a single root node is left.
+    bool leaf = true;
+    do
+    {
+        items = packLevel(items, leaf, _nodes);
+        leaf = false;
+    } while (items.size() > ROOT_SIZE);
+}
+
+/**
+ * @brief Find all the Shapes which their Bounding Box overlaps the given Bounding Box.
+ * @param box The Bounding Box to query.
+ * @param result The Vector which the indices of the found Shapes are added to.
+ */
+void RTree::query(const BoundingBox& box, std::vector<ShapeIndex>& result) const
+{
+    if (_nodes.empty())
+    {
+        return;
+    }
+
+    std::vector<NodeIndex> stack(ROOT_SIZE, _nodes.size() - 1);
+    while (!stack.empty())
+    {
+        const RTreeNode& node = _nodes[stack.back()];
+        stack.pop_back();
+
+        for (unsigned int i = 0; i < node.count; i++)
+        {
+            if (node.minX[i] <= box.getMaxX() && box.getMinX() <= node.maxX[i] &&
+                node.minY[i] <= box.getMaxY() && box.getMinY() <= node.maxY[i])
+            {
+                if (node.leaf)
+                {
+                    result.push_back(node.child[i]);
+                }
+                else
+                {
+                    stack.push_back(node.child[i]);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Find all the pairs of Shapes that overlap where one Shape is under the first given
+ *        node and the other is under the second given node. If both nodes are the same node,
+ *        the pairs are found inside this node.
+ * @param first The first node.
+ * @param second The second node.
+ * @param job The job to run on every pair found.
+ */
+void RTree::_join(NodeIndex const first, NodeIndex const second,
+                  const std::function<void(ShapeIndex, ShapeIndex)>& job) const
+{
+    // All the leaves of an STR tree are in the same depth, so both nodes are leaves or not.
+    const RTreeNode& a = _nodes[first];
+    const RTreeNode& b = _nodes[second];
+    bool sameNode = first == second;
+
+    for (unsigned int i = 0; i < a.count; i++)
+    {
+        // Inside a single node, every pair of children is joined once, and every child is
+        // joined with itself.
+        unsigned int j = sameNode ? i : 0;
+        for (; j < b.count; j++)
+        {
+            if (sameNode && i == j)
+            {
+                if (!a.leaf)
+                {
+                    _join(a.child[i], a.child[i], job);
+                }
+                continue;
+            }
+            if (!childrenOverlap(a, i, b, j))
+            {
+                continue;
+            }
+            if (a.leaf)
+            {
+                job(std::min(a.child[i], b.child[j]), std::max(a.child[i], b.child[j]));
+            }
+            else
+            {
+                _join(a.child[i], b.child[j], job);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Find all the pairs of Shapes which their Bounding Boxes overlap, by joining the tree
+ *        with itself. Every pair appears once. The pairs are not sorted.
+ * @param result The Vector which the found pairs are added to.
+ */
+void RTree::candidatePairs(PairVector& result) const
+{
+    // Every thread keeps it's own pairs, and the pairs are joined in the order of the threads.
+    std::vector<PairVector> found(getThreadCount());
+    forEachCandidatePair([&found](ShapeIndex first, ShapeIndex second, ThreadCount thread)
+    {
+        found[thread].push_back({first, second});
+    });
+    for (auto i = found.begin(); i != found.end(); i++)
+    {
+        result.insert(result.end(), i -> begin(), i -> end());
+    }
+}
+
+/**
+ * @brief Run the given job on all the pairs of Shapes which their Bounding Boxes overlap, by
+ *        joining the tree with itself, without keeping the pairs. The join is split between the
+ *        worker threads, and every pair is handed once to the job, together with the thread
+ *        which found it. The pairs come in no particular order.
+ * @param job The job to run on every pair found.
+ */
+void RTree::forEachCandidatePair(const PairJob& job) const
+{
+    if (_nodes.empty())
+    {
+        return;
+    }
+
+    ThreadCount threads = getThreadCount();
+    std::vector<JoinTask> tasks = splitJoin(_nodes, threads);
+    parallelFor(tasks.size(), threads, [this, &tasks, &job](size_t begin, size_t end,
+                                                           ThreadCount thread)
+    {
+        for (size_t task = begin; task < end; task++)
+        {
+            _join(tasks[task].first, tasks[task].second,
+                  [&job, thread](ShapeIndex first, ShapeIndex second)
+                  {
+                      job(first, second, thread);
+                  });
+        }
+    });
+}
+
+/**
+ * @brief Find all the pairs of intersecting Shapes, by joining the tree with itself and checking
+ *        every pair which their Bounding Boxes overlap. Every worker thread keeps it's own pairs,
+ *        and the pairs are sorted by their first index and then by their second index, so the
+ *        result does not depend on the amount of threads.
+ * @param shapes The ShapeStore which the tree was built from.
+ * @param result The Vector which the found pairs are added to.
+ */
+void RTree::findAllIntersections(const ShapeStore& shapes, PairVector& result) const
+{
+    if (_nodes.empty())
+    {
+        return;
+    }
+
+    ThreadCount threads = getThreadCount();
+    std::vector<JoinTask> tasks = splitJoin(_nodes, threads);
+    std::vector<PairVector> found(threads);
+    parallelFor(tasks.size(), threads, [this, &shapes, &tasks, &found](size_t begin, size_t end,
+                                                                      ThreadCount thread)
+    {
+        PairVector& pairs = found[thread];
+        for (size_t task = begin; task < end; task++)
+        {
+            _join(tasks[task].first, tasks[task].second,
+                  [&shapes, &pairs](ShapeIndex first, ShapeIndex second)
+                  {
+                      // The tree joins only Shapes which their Bounding Boxes overlap.
+                      if (intersectShapes(shapes.getShape(first), shapes.getShape(second)))
+                      {
+                          pairs.push_back({first, second});
+                      }
+                  });
+        }
+    });
+
+    size_t begin = result.size();
+    for (auto i = found.begin(); i != found.end(); i++)
+    {
+        result.insert(result.end(), i -> begin(), i -> end());
+    }
+    parallelSort(result, begin, result.size(), threads, [](const ShapePair& a, const ShapePair& b)
+    {
+        return a.first < b.first || (a.first == b.first && a.second < b.second);
+    });
+}
+
+/**
+ * @brief Count the pairs of intersecting Shapes, the same pairs which are found by
+ *        findAllIntersections, without keeping them.
+ * @param shapes The ShapeStore which the tree was built from.
+ * @return The amount of pairs of intersecting Shapes.
+ */
+size_t RTree::countIntersections(const ShapeStore& shapes) const
+{
+    if (_nodes.empty())
+    {
+        return 0;
+    }
+
+    ThreadCount threads = getThreadCount();
+    std::vector<JoinTask> tasks = splitJoin(_nodes, threads);
+    std::vector<size_t> counts(threads, 0);
+    parallelFor(tasks.size(), threads, [this, &shapes, &tasks, &counts](size_t begin, size_t end,
+                                                                       ThreadCount thread)
+    {
+        // Every thread counts in it's own variable, and writes it's count once at the end.
+        size_t count = 0;
+        for (size_t task = begin; task < end; task++)
+        {
+            _join(tasks[task].first, tasks[task].second,
+                  [&shapes, &count](ShapeIndex first, ShapeIndex second)
+                  {
+                      if (intersectShapes(shapes.getShape(first), shapes.getShape(second)))
+                      {
+                          count++;
+                      }
+                  });
+        }
+        counts[thread] = count;
+    });
+
+    size_t total = 0;
+    for (auto i = counts.begin(); i != counts.end(); i++)
+    {
+        total += *i;
+    }
+    return total;
+}
+
+/**
+ * @brief Find the first pair of intersecting Shapes, i.e. the pair with the smallest first
+ *        index, and among those the pair with the smallest second index.
+ *        Every Shape is checked only with the later Shapes that the tree finds around it.
+ *        The Shapes are handed to the worker threads in blocks, in their order. The smallest
+ *        first index found so far is shared by all the threads, and Shapes after it are
+ *        skipped. A long list of later Shapes is checked as a batch of edges.
+ * @param shapes The ShapeStore which the tree was built from.
+ * @param first The index of the first Shape in the found pair.
+ * @param second The index of the second Shape in the found pair.
+ * @return true if there is at least one intersection, false otherwise.
+ */
+bool RTree::findFirstIntersection(const ShapeStore& shapes, ShapeIndex& first,
+                                  ShapeIndex& second) const
+{
+    // Every Shape is checked by a single thread, which finds the smallest second index for it.
+    // So the bound needs only the first index, and every thread keeps the pair it found.
+    ThreadCount threads = getThreadCount();
+    std::atomic<ShapeIndex> bound(shapes.size());
+    std::vector<ShapePair> best(threads, {shapes.size(), shapes.size()});
+    std::vector<std::vector<ShapeIndex>> candidates(threads);
+    std::vector<EdgeBatch> batches(threads);
+
+    parallelForBlocks(shapes.size(), SEARCH_BLOCK_SIZE, threads,
+                      [this, &shapes, &bound, &best, &candidates, &batches](size_t begin,
+                                                                            size_t end,
+                                                                            ThreadCount thread)
+    {
+        std::vector<ShapeIndex>& found = candidates[thread];
+        for (ShapeIndex i = begin; i < end; i++)
+        {
+            // Shapes after the first Shape of a found pair can not change the result.
+            if (i >= bound.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+
+            found.clear();
+            query(shapes.getBoundingBox(i), found);
+            std::sort(found.begin(), found.end());
+            size_t later = std::upper_bound(found.begin(), found.end(), i) - found.begin();
+            ShapeIndex j;
+            if (findFirstCandidate(shapes, i, found.data() + later, found.size() - later,
+                                   batches[thread], j))
+            {
+                if (i < best[thread].first)
+                {
+                    best[thread] = {i, j};
+                }
+                ShapeIndex current = bound.load(std::memory_order_relaxed);
+                while (i < current && !bound.compare_exchange_weak(current, i))
+                {
+                    // On failure the current bound was loaded into 'current', so we try again.
+                }
+                return;
+            }
+        }
+    });
+
+    ShapePair result = {shapes.size(), shapes.size()};
+    for (auto i = best.begin(); i != best.end(); i++)
+    {
+        if (i -> first < result.first)
+        {
+            result = *i;
+        }
+    }
+    first = result.first;
+    second = result.second;
+    return result.first != shapes.size();
+}
@@ -0,0 +1,173 @@
+/**
+ * @file RTree.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header File for the RTree Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the RTree Class.
+ * Declaring the RTree Class, it's methods and fields.
+ * An RTree class is a tree of Bounding Boxes, where every node holds the Bounding Boxes of it's
+ * children and the leaves hold the Bounding Boxes of the Shapes. The tree is built at once from
+ * all the Shapes using Sort-Tile-Recursive (STR) packing, so every node is full and nodes which
+ * are close in the plane are close in memory. Unlike a uniform grid, the tree adapts to the
+ * input, so it suits inputs where the Shapes are spread unevenly.
+ */
+
+
+#ifndef RTREE_H
+#define RTREE_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <vector>
+#include <functional>
+#include "ShapeStore.h"
+#include "Parallel.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def RTREE_NODE_CAPACITY 16
+ * @brief A Macro that sets the largest amount of children in a node of the tree.
+ */
+#define RTREE_NODE_CAPACITY 16
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief NodeIndex is the position of a node in the tree's nodes storage.
+ */
+typedef size_t NodeIndex;
+
+/**
+ * @brief PairJob is a job which runs on a single pair of Shapes in the given worker thread.
+ */
+typedef std::function<void(ShapeIndex first, ShapeIndex second, ThreadCount thread)> PairJob;
+
+/**
+ * @brief A Struct representing a single node of the tree.
+ *        The Bounding Boxes of the children are kept in separate continuous arrays, so checking
+ *        all the children of a node against a Bounding Box reads only a few cache lines.
+ */
+struct RTreeNode
+{
+    CordType minX[RTREE_NODE_CAPACITY];   // The smallest X value of every child.
+    CordType minY[RTREE_NODE_CAPACITY];   // The smallest Y value of every child.
+    CordType maxX[RTREE_NODE_CAPACITY];   // The largest X value of every child.
+    CordType maxY[RTREE_NODE_CAPACITY];   // The largest Y value of every child.
+    size_t child[RTREE_NODE_CAPACITY];    // The index of every child node, or Shape in a leaf.
+    unsigned int count;                   // The amount of children in the node.
+    bool leaf;                            // true if the children of the node are Shapes.
+};
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class representing a bulk loaded R-Tree over the Bounding Boxes of the Shapes.
+ *        The tree finds the Shapes which overlap a given Bounding Box, and the pairs of Shapes
+ *        which overlap each other.
+ */
+class RTree
+{
+public:
+
+    /**
+     * @brief A Constructor for the RTree, which creates an empty tree.
+     */
+    RTree();
+
+    /**
+     * @brief Build the tree from all the given Shapes using Sort-Tile-Recursive packing.
+     *        The sorts are done using all the worker threads.
+     * @param shapes The Shapes to hold in the tree.
+     */
+    void build(const ShapeStore& shapes);
+
+    /**
+     * @brief Find all the Shapes which their Bounding Box overlaps the given Bounding Box.
+     * @param box The Bounding Box to query.
+     * @param result The Vector which the indices of the found Shapes are added to.
+     */
+    void query(const BoundingBox& box, std::vector<ShapeIndex>& result) const;
+
+    /**
+     * @brief Find all the pairs of Shapes which their Bounding Boxes overlap, by joining the tree
+     *        with itself. Every pair appears once. The pairs are not sorted.
+     * @param result The Vector which the found pairs are added to.
+     */
+    void candidatePairs(PairVector& result) const;
+
+    /**
+     * @brief Run the given job on all the pairs of Shapes which their Bounding Boxes overlap, by
+     *        joining the tree with itself, without keeping the pairs. The join is split between
+     *        the worker threads, and every pair is handed once to the job, together with the
+     *        thread which found it. The pairs come in no particular order.
+     * @param job The job to run on every pair found.
+     */
+    void forEachCandidatePair(const PairJob& job) const;
+
+    /**
+     * @brief Find all the pairs of intersecting Shapes, by joining the tree with itself and
+     *        checking every pair which their Bounding Boxes overlap. Every worker thread keeps
+     *        it's own pairs, and the pairs are sorted by their first index and then by their
+     *        second index, so the result does not depend on the amount of threads.
+     * @param shapes The ShapeStore which the tree was built from.
+     * @param result The Vector which the found pairs are added to.
+     */
+    void findAllIntersections(const ShapeStore& shapes, PairVector& result) const;
+
+    /**
+     * @brief Count the pairs of intersecting Shapes, the same pairs which are found by
+     *        findAllIntersections, without keeping them.
+     * @param shapes The ShapeStore which the tree was built from.
+     * @return The amount of pairs of intersecting Shapes.
+     */
+    size_t countIntersections(const ShapeStore& shapes) const;
+
+    /**
+     * @brief Find the first pair of intersecting Shapes, i.e. the pair with the smallest first
+     *        index, and among those the pair with the smallest second index.
+     *        Every Shape is checked only with the later Shapes that the tree finds around it.
+     *        The Shapes are handed to the worker threads in blocks, in their order. The smallest
+     *        first index found so far is shared by all the threads, and Shapes after it are
+     *        skipped. A long list of later Shapes is checked as a batch of edges.
+     * @param shapes The ShapeStore which the tree was built from.
+     * @param first The index of the first Shape in the found pair.
+     * @param second The index of the second Shape in the found pair.
+     * @return true if there is at least one intersection, false otherwise.
+     */
+    bool findFirstIntersection(const ShapeStore& shapes, ShapeIndex& first,
+                               ShapeIndex& second) const;
+
+private:
+    // RTree Private Fields.
+    std::vector<RTreeNode> _nodes;  // All the nodes of the tree, where the root is the last node.
+
+    /**
+     * @brief Find all the pairs of Shapes that overlap where one Shape is under the first given
+     *        node and the other is under the second given node. If both nodes are the same node,
+     *        the pairs are found inside this node.
+     * @param first The first node.
+     * @param second The second node.
+     * @param job The job to run on every pair found.
+     */
+    void _join(NodeIndex const first, NodeIndex const second,
+               const std::function<void(ShapeIndex, ShapeIndex)>& job) const;
+};
+
+
+#endif
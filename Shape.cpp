@@ -34,10 +34,14 @@
  * @param shapeType The specific type of the Shape.
  * @param points Vector of Points which will be the Shape's vertices.
  */
-Shape::Shape(ShapeName const shapeType, const PointVector& points)
+Shape::Shape(ShapeType const shapeType, const PointVector& points)
         : _points(points), _area(EMPTY_SHAPE_SIZE), _shapeType(shapeType)
 {
-
+    for (auto i = _points.begin(); i != _points.end(); i++)
+    {
+        _boundingBox.expand(*i);
+    }
+    _calculateEdges();
 }
 
 /**
@@ -98,25 +102,44 @@ PointIterator Shape::_getNextVertex(PointIterator const currentIterator, const S
 }
 
 
+/**
+ * @brief Calculate the lines of all the edges of this Shape.
+ */
+void Shape::_calculateEdges()
+{
+    PointIterator j;
+    for (auto i = _points.begin(); i != _points.end(); i++)
+    {
+        // Determine the current edge using the 'i' and 'j' values.
+        j = _getNextVertex(i, *this);
+
+        // The Determinant of a Point (x, y) with the edge, expanded by the Rule of Sarrus and
+        // grouped by x and y, so the side of any Point costs two products.
+        EdgeLine line;
+        line.a = i -> getY() - j -> getY();
+        line.b = j -> getX() - i -> getX();
+        line.c = (i -> getX() * j -> getY()) - (i -> getY() * j -> getX());
+        _edges.push_back(line);
+    }
+}
+
+
 /*-----=  Shape Intersection  =-----*/
 
 
 /**
- * @brief Determine if a given 2 edges (lines) are intersect.
- *        The edges are given by 4 Points, the first 2 forms the first edge, the other forms the
- *        second edge. (p1-p2 is one edge, p3-p4 is another edge).
+ * @brief Determine if the first given edge crosses the line of the second given edge.
+ *        The first edge is given by it's 2 Points, and the second edge by it's line.
  *        Note: I had to change the name from 's_edgesIntersectHelper' because of the script bug
  * @param p1 The first Point in edge one.
  * @param p2 The second Point in edge one.
- * @param p3 The first Point in edge two.
- * @param p4 The second Point in edge two.
- * @return true if the edges intersect, false otherwise.
+ * @param line The line of edge two.
+ * @return true if the Points of the first edge are on different sides of the line.
  */
-bool Shape::_edgesIntersectHelper(const Point &p1, const Point &p2,
-                                  const Point &p3, const Point &p4)
+bool Shape::_edgesIntersectHelper(const Point &p1, const Point &p2, const EdgeLine& line)
 {
-    CordType firstPointSide = DETERMINANT_FACTOR * _calculateDet(p1, p3, p4);
-    CordType secondPointSide = DETERMINANT_FACTOR * _calculateDet(p2, p3, p4);
+    CordType firstPointSide = line.valueAt(p1.getX(), p1.getY());
+    CordType secondPointSide = line.valueAt(p2.getX(), p2.getY());
 
     // If the result of this multiply is negative, it means that the values of the sides
     // have different signs (i.e. one is negative and one positive),
@@ -133,14 +156,16 @@ bool Shape::_edgesIntersectHelper(const Point &p1, const Point &p2,
  *        Note: I had to change the name from 's_edgesIntersect' because of the script bug.
  * @param p1 The first Point in edge one.
  * @param p2 The second Point in edge one.
+ * @param firstLine The line of edge one.
  * @param p3 The first Point in edge two.
  * @param p4 The second Point in edge two.
+ * @param secondLine The line of edge two.
  * @return true if the edges intersect, false otherwise.
  */
-bool Shape::_edgesIntersect(const Point &p1, const Point &p2,
-                            const Point &p3, const Point &p4)
+bool Shape::_edgesIntersect(const Point &p1, const Point &p2, const EdgeLine& firstLine,
+                            const Point &p3, const Point &p4, const EdgeLine& secondLine)
 {
-    return _edgesIntersectHelper(p1, p2, p3, p4) && _edgesIntersectHelper(p3, p4, p1, p2);
+    return _edgesIntersectHelper(p1, p2, secondLine) && _edgesIntersectHelper(p3, p4, firstLine);
 }
 
 /**
@@ -148,19 +173,22 @@ bool Shape::_edgesIntersect(const Point &p1, const Point &p2,
  *        edge from a given Shape.
  * @param p1 The first Point in edge.
  * @param p2 The second Point in edge.
+ * @param line The line of the edge.
  * @param other The Shape to check intersection with.
  * @return true if one of the edges from the given other Shape intersect with the given edge.
  */
-bool Shape::_intersectWithHelper(const Point& p1, const Point& p2, const Shape& other) const
+bool Shape::_intersectWithHelper(const Point& p1, const Point& p2, const EdgeLine& line,
+                                 const Shape& other) const
 {
     PointIterator j;
-    for (auto i = other._points.begin(); i != other._points.end(); i++)
+    auto otherLine = other._edges.begin();
+    for (auto i = other._points.begin(); i != other._points.end(); i++, otherLine++)
     {
         // Determine the current edge to check using the 'i' and 'j' values.
         j = _getNextVertex(i, other);
 
         // For each edge in the given other Shape, we check the intersection with our given edge.
-        if (_edgesIntersect(p1, p2, *i, *j))
+        if (_edgesIntersect(p1, p2, line, *i, *j, *otherLine))
         {
             return true;
         }
@@ -176,14 +204,15 @@ bool Shape::_intersectWithHelper(const Point& p1, const Point& p2, const Shape&
 bool Shape::intersectWith(const Shape& other) const
 {
     PointIterator j;
-    for (auto i = _points.begin(); i != _points.end(); i++)
+    auto line = _edges.begin();
+    for (auto i = _points.begin(); i != _points.end(); i++, line++)
     {
         // Determine the current edge to check using the 'i' and 'j' values.
         j = _getNextVertex(i, *this);
 
         // For each edge in this Shape, we check the intersection with any other edge
         // in the given other Shape.
-        if (_intersectWithHelper(*i, *j, other))
+        if (_intersectWithHelper(*i, *j, *line, other))
         {
             return true;
         }
@@ -196,24 +225,15 @@ bool Shape::intersectWith(const Shape& other) const
 
 
 /**
- * @brief With a given Vector of boolean values of some Vertex's data, we determine if
- *        the Vertex appears each time on the same side, where true value represent
- *        the right-side and false value represent the left-side.
- *        If all the sides are the same, i.e. all true or all false, then we return true.
- *        Note: I had to change the name from 's_checkVertexSides' because of the script bug.
- * @param sides The Sides Vector of a Vertex.
- * @return true if all the sides in the Sides Vector are the same, false otherwise.
+ * @brief Determine the side of the given Point according to the given edge.
+ * @param p1 The given Point to check.
+ * @param line The line of the edge.
+ * @return true if the Point appears on the right side of the edge, false for the left side.
  */
-bool Shape::_checkVertexSides(const std::vector<bool> &sides)
+bool Shape::_vertexSide(const Point& p1, const EdgeLine& line)
 {
-    for (auto i = sides.begin(); i != (sides.end() - 1); i++)
-    {
-        if (*i != *(i + 1))
-        {
-            return false;
-        }
-    }
-    return true;
+    CordType k = line.valueAt(p1.getX(), p1.getY());
+    return k < 0;  // True for right-side, false for left-side.
 }
 
 /**
@@ -225,25 +245,62 @@ bool Shape::_checkVertexSides(const std::vector<bool> &sides)
  */
 bool Shape::_checkVertexWithShape(const Point& p1, const Shape& other) const
 {
-    // Storing the different sides that the given Point appears in according to the Shapes edges.
-    // The boolean value 'true' represent that the Point appears on the right side, and false
-    // represent the left side.
-    std::vector<bool> sides;
+    // The side of the first edge is the side that all the other edges should match.
+    auto first = other._edges.begin();
+    bool firstSide = _vertexSide(p1, *first);
 
-    PointIterator j;
-    for (auto i = other._points.begin(); i != other._points.end(); i++)
+    for (auto i = first + 1; i != other._edges.end(); i++)
     {
-        // Determine the current edge to check using the 'i' and 'j' values.
-        j = _getNextVertex(i, other);
-
-        // For each edge in the given other Shape, we determine the side of the Point according to
-        // the current edge.
-        CordType k = DETERMINANT_FACTOR * _calculateDet(p1, *i, *j);
-        sides.push_back((k < 0));  // True for right-side, false for left-side.
+        // The Point is outside as soon as it appears on a different side of some edge.
+        if (_vertexSide(p1, *i) != firstSide)
+        {
+            return false;
+        }
     }
+    return true;
+}
+
+/**
+ * @brief Determine if any Vertex of the first given Shape is inside the second Shape, checking
+ *        all the Vertices together in a single pass over the edges of the second Shape.
+ *        A Vertex stops being checked as soon as it appears on two different sides.
+ * @param firstShape The Shape which it's Vertices are checked.
+ * @param secondShape The Shape to check with.
+ * @return true if a Vertex of the first Shape is inside the second Shape, false otherwise.
+ */
+bool Shape::_checkVerticesWithShape(const Shape& firstShape, const Shape& secondShape) const
+{
+    const PointVector& vertices = firstShape._points;
+    ShapeSize count = (ShapeSize) vertices.size();
+
+    // 'inside' holds the Vertices which appeared on the same side of all the edges so far, and
+    // 'sides' holds the side of every Vertex according to the first edge.
+    VertexMask inside = count == MAX_BATCH_VERTICES ? ~(VertexMask) 0 :
+                        (((VertexMask) 1 << count) - 1);
+    VertexMask sides = 0;
 
-    // Check that for all edges in the Shape, the Point appears on the same side of them.
-    return _checkVertexSides(sides);
+    for (auto i = secondShape._edges.begin(); i != secondShape._edges.end(); i++)
+    {
+        VertexMask edgeSides = 0;
+        for (ShapeSize v = 0; v < count; v++)
+        {
+            edgeSides |= (VertexMask) _vertexSide(vertices[v], *i) << v;
+        }
+        if (i == secondShape._edges.begin())
+        {
+            sides = edgeSides;
+        }
+        else
+        {
+            // A Vertex which appears on a different side than before is outside the Shape.
+            inside &= ~(edgeSides ^ sides);
+            if (inside == 0)
+            {
+                return false;
+            }
+        }
+    }
+    return inside != 0;
 }
 
 /**
@@ -256,6 +313,12 @@ bool Shape::_checkVertexWithShape(const Point& p1, const Shape& other) const
  */
 bool Shape::_subsetOfHelper(const Shape& firstShape, const Shape& secondShape) const
 {
+    // All the Vertices are checked in a single pass over the edges when they fit in a mask.
+    if (firstShape._points.size() <= MAX_BATCH_VERTICES)
+    {
+        return _checkVerticesWithShape(firstShape, secondShape);
+    }
+
     // We check if any Vertex from the first Shape is inside the second Shape.
     for (auto i = firstShape._points.begin(); i != firstShape._points.end(); i++)
     {
@@ -26,10 +26,13 @@
 /*-----=  Includes  =-----*/
 
 
+#include <cstdint>
 #include <vector>
 #include <string>
 #include "Point.h"
+#include "BoundingBox.h"
 #include "PrintOuts.h"
+#include "InlineVector.h"
 
 
 /*-----=  Definitions  =-----*/
@@ -53,12 +56,34 @@
  */
 #define DETERMINANT_FACTOR 0.5
 
+/**
+ * @def MAX_BATCH_VERTICES 64
+ * @brief A Macro that sets the largest amount of Vertices which are checked together in a single
+ *        pass over the edges of another Shape, i.e. the amount of bits in a VertexMask.
+ */
+#define MAX_BATCH_VERTICES 64
+
+/**
+ * @def MAX_SHAPE_VERTICES 4
+ * @brief A Macro that sets the largest amount of Vertices of a Shape, which is the amount of
+ *        Vertices of the largest Shape type (a Trapezoid). The Vertices and the edges of a Shape
+ *        are kept inside the Shape object up to this amount.
+ */
+#define MAX_SHAPE_VERTICES 4
+
+/**
+ * @def SHAPE_TYPE_COUNT 3
+ * @brief A Macro that sets the amount of values in the ShapeType Enum, including INVALID_TYPE.
+ */
+#define SHAPE_TYPE_COUNT 3
+
 
 /*-----=  Type Definitions  =-----*/
 
 
 /**
  * @brief ShapeName is an string representing the name (type) of this Shape.
+ *        A Shape keeps only it's ShapeType, and the name is made only for the error messages.
  */
 typedef std::string ShapeName;
 
@@ -69,13 +94,60 @@ typedef unsigned int ShapeSize;
 
 /**
  * @brief PointVector is the Points Vector which is the Container of the Points.
+ *        The Points are kept inside the Vector, so a Shape holds it's Vertices without any
+ *        allocation.
  */
-typedef std::vector<Point> PointVector;
+typedef InlineVector<Point, MAX_SHAPE_VERTICES> PointVector;
 
 /**
  * @brief PointIterator is an a const iterator of the Points Vector.
  */
-typedef std::vector<Point>::const_iterator PointIterator;
+typedef PointVector::const_iterator PointIterator;
+
+/**
+ * @brief VertexMask is a set of Vertices of a Shape, where bit i stands for the Vertex i.
+ */
+typedef uint64_t VertexMask;
+
+/**
+ * @brief A Struct representing the line of an edge from a Point P to a Point Q, as the equation
+ *        a * x + b * y + c. The value of the equation in a Point has the same sign as the
+ *        Determinant of this Point with P and Q, so it tells the side of the Point.
+ */
+struct EdgeLine
+{
+    CordType a;     // The coefficient of the X coordinate.
+    CordType b;     // The coefficient of the Y coordinate.
+    CordType c;     // The constant coefficient.
+
+    /**
+     * @brief Calculate the value of the line equation in the given Point.
+     * @param x The X coordinate of the Point.
+     * @param y The Y coordinate of the Point.
+     * @return The value of the line equation, which is negative on the right side of the edge.
+     */
+    CordType valueAt(CordType const x, CordType const y) const { return (a * x) + (b * y) + c; };
+};
+
+/**
+ * @brief EdgeLineVector is the Vector of the lines of the edges of a Shape, where line i is the
+ *        line of the edge from Vertex i to the next Vertex.
+ */
+typedef InlineVector<EdgeLine, MAX_SHAPE_VERTICES> EdgeLineVector;
+
+
+/*-----=  Enums  =-----*/
+
+
+/**
+ * @brief An Enum for the different types of Shapes.
+ */
+enum ShapeType
+{
+    INVALID_TYPE,
+    TRIANGLE,
+    TRAPEZOID
+};
 
 
 /*-----=  Class Definitions  =-----*/
@@ -99,7 +171,7 @@ public:
      * @param shapeType The specific type of the Shape.
      * @param points Vector of Points which will be the Shape's vertices.
      */
-    Shape(ShapeName const shapeType, const PointVector& points);
+    Shape(ShapeType const shapeType, const PointVector& points);
 
     /**
      * @brief The Destructor for the Shape Class.
@@ -116,7 +188,39 @@ public:
      * @brief Returns the type of this Shape.
      * @return The type of this Shape.
      */
-    ShapeName getType() const { return _shapeType; };
+    ShapeType getType() const { return _shapeType; };
+
+    /**
+     * @brief Returns the Vertices of this Shape.
+     * @return A reference to the Points Vector which holds the Vertices of this Shape.
+     */
+    const PointVector& getPoints() const { return _points; };
+
+    /**
+     * @brief Returns the lines of the edges of this Shape, which are calculated once when the
+     *        Shape is created.
+     * @return A reference to the Vector which holds the lines of the edges of this Shape.
+     */
+    const EdgeLineVector& getEdges() const { return _edges; };
+
+    /**
+     * @brief Returns the Bounding Box of this Shape, i.e. the smallest rectangle with edges
+     *        parallel to the axes which contains all the Vertices of this Shape.
+     * @return The Bounding Box of this Shape.
+     */
+    const BoundingBox& getBoundingBox() const { return _boundingBox; };
+
+    /**
+     * @brief Determine if the Bounding Box of a given Shape overlaps the Bounding Box of this
+     *        Shape. Shapes which their Bounding Boxes do not overlap can not intersect, so this
+     *        check can reject a pair of Shapes before any Determinant is calculated.
+     * @param other The Shape to check with.
+     * @return true if the Bounding Boxes overlap, false otherwise.
+     */
+    bool boundingBoxOverlap(const Shape& other) const
+    {
+        return _boundingBox.overlaps(other._boundingBox);
+    };
 
     /**
      * @brief Determine if a given Shape intersect with this Shape.
@@ -161,7 +265,17 @@ protected:
     /**
      * @brief The specific type of this Shape.
      */
-    const ShapeName _shapeType;
+    const ShapeType _shapeType;
+
+    /**
+     * @brief The Bounding Box of this Shape's Vertices.
+     */
+    BoundingBox _boundingBox;
+
+    /**
+     * @brief The lines of this Shape's edges, in the order of the Vertices.
+     */
+    EdgeLineVector _edges;
 
     /**
      * @brief Calculate the Determinant of the given 3 Points as specified in the Description.
@@ -189,15 +303,17 @@ protected:
 private:
 
     /**
-     * @brief With a given Vector of boolean values of some Vertex's data, we determine if
-     *        the Vertex appears each time on the same side, where true value represent
-     *        the right-side and false value represent the left-side.
-     *        If all the sides are the same, i.e. all true or all false, then we return true.
-     *        Note: I had to change the name from 's_checkVertexSides' because of the script bug.
-     * @param sides The Sides Vector of a Vertex.
-     * @return true if all the sides in the Sides Vector are the same, false otherwise.
+     * @brief Calculate the lines of all the edges of this Shape.
+     */
+    void _calculateEdges();
+
+    /**
+     * @brief Determine the side of the given Point according to the given edge.
+     * @param p1 The given Point to check.
+     * @param line The line of the edge.
+     * @return true if the Point appears on the right side of the edge, false for the left side.
      */
-    static bool _checkVertexSides(const std::vector<bool> &sides);
+    static bool _vertexSide(const Point& p1, const EdgeLine& line);
 
     /**
      * @brief Determine if all the Points in the Points Vector are different from one another.
@@ -206,18 +322,15 @@ private:
     bool _checkDistinguishPoints() const;
 
     /**
-     * @brief Determine if a given 2 edges (lines) are intersect.
-     *        The edges are given by 4 Points, the first 2 forms the first edge, the other forms the
-     *        second edge. (p1-p2 is one edge, p3-p4 is another edge).
+     * @brief Determine if the first given edge crosses the line of the second given edge.
+     *        The first edge is given by it's 2 Points, and the second edge by it's line.
      *        Note: I had to change the name from 's_edgesIntersectHelper' because of the script bug
      * @param p1 The first Point in edge one.
      * @param p2 The second Point in edge one.
-     * @param p3 The first Point in edge two.
-     * @param p4 The second Point in edge two.
-     * @return true if the edges intersect, false otherwise.
+     * @param line The line of edge two.
+     * @return true if the Points of the first edge are on different sides of the line.
      */
-    static bool _edgesIntersectHelper(const Point &p1, const Point &p2,
-                                      const Point &p3, const Point &p4);
+    static bool _edgesIntersectHelper(const Point &p1, const Point &p2, const EdgeLine& line);
 
     /**
      * @brief Determine if a given 2 edges (lines) are intersect.
@@ -228,21 +341,26 @@ private:
      *        Note: I had to change the name from 's_edgesIntersect' because of the script bug.
      * @param p1 The first Point in edge one.
      * @param p2 The second Point in edge one.
+     * @param firstLine The line of edge one.
      * @param p3 The first Point in edge two.
      * @param p4 The second Point in edge two.
+     * @param secondLine The line of edge two.
      * @return true if the edges intersect, false otherwise.
      */
-    static bool _edgesIntersect(const Point &p1, const Point &p2, const Point &p3, const Point &p4);
+    static bool _edgesIntersect(const Point &p1, const Point &p2, const EdgeLine& firstLine,
+                                const Point &p3, const Point &p4, const EdgeLine& secondLine);
 
     /**
      * @brief Determine if a given edge from a Shape (given by 2 Points) intersect with another
      *        edge from a given Shape.
      * @param p1 The first Point in edge.
      * @param p2 The second Point in edge.
+     * @param line The line of the edge.
      * @param other The Shape to check intersection with.
      * @return true if one of the edges from the given other Shape intersect with the given edge.
      */
-    bool _intersectWithHelper(const Point& p1, const Point& p2, const Shape& other) const;
+    bool _intersectWithHelper(const Point& p1, const Point& p2, const EdgeLine& line,
+                              const Shape& other) const;
 
     /**
      * @brief Determine if a given Point is inside the other Shapes boundaries, i.e when we iterate
@@ -253,6 +371,16 @@ private:
      */
     bool _checkVertexWithShape(const Point& p1, const Shape& other) const;
 
+    /**
+     * @brief Determine if any Vertex of the first given Shape is inside the second Shape, checking
+     *        all the Vertices together in a single pass over the edges of the second Shape.
+     *        A Vertex stops being checked as soon as it appears on two different sides.
+     * @param firstShape The Shape which it's Vertices are checked.
+     * @param secondShape The Shape to check with.
+     * @return true if a Vertex of the first Shape is inside the second Shape, false otherwise.
+     */
+    bool _checkVerticesWithShape(const Shape& firstShape, const Shape& secondShape) const;
+
     /**
      * @brief Determine if the first given Shape is a sub-set of the second Shape.
      *        By sub-set of we mean that there exist a Point from one Shape that is inside the
@@ -0,0 +1,143 @@
+/**
+ * @file ShapeArena.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A File for the ShapeArena Class implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the ShapeArena Class implementation.
+ * Define the ShapeArena Class, it's methods and fields.
+ * The arena allocates by moving a pointer forward in it's current block, and takes a new block
+ * only when the current block is full, so creating a Shape costs no call to the heap.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <cstdint>
+#include "ShapeArena.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def ARENA_BLOCK_SIZE 1048576
+ * @brief A Macro that sets the size in bytes of a regular block of the arena.
+ */
+#define ARENA_BLOCK_SIZE 1048576
+
+
+/*-----=  Constructors & Destructors  =-----*/
+
+
+/**
+ * @brief A Constructor for the ShapeArena, which creates an arena without any block.
+ */
+ShapeArena::ShapeArena() : _current(nullptr), _end(nullptr)
+{
+
+}
+
+/**
+ * @brief A Destructor for the ShapeArena, which frees all of it's blocks.
+ */
+ShapeArena::~ShapeArena()
+{
+    release();
+}
+
+
+/*-----=  ShapeArena Methods  =-----*/
+
+
+/**
+ * @brief Allocate a new block which has room for at least the given amount of bytes, and make
+ *        it the current block.
+ * @param size The amount of bytes which the block must hold.
+ */
+void ShapeArena::_addBlock(size_t const size)
+{
+    size_t blockSize = std::max((size_t) ARENA_BLOCK_SIZE, size);
+    ArenaBlock block = {new char[blockSize], blockSize};
+    _blocks.push_back(block);
+    _current = block.memory;
+    _end = block.memory + blockSize;
+}
+
+/**
+ * @brief Allocate memory of the given size from the current block of the arena, or from a
+ *        new block if the current block is full. The memory is valid until the arena frees
+ *        it's blocks.
+ * @param size The amount of bytes to allocate.
+ * @param alignment The alignment of the memory, which is at most the alignment of any type.
+ * @return A pointer to the allocated memory.
+ */
+void *ShapeArena::allocate(size_t const size, size_t const alignment)
+{
+    size_t padding = (alignment - (uintptr_t) _current % alignment) % alignment;
+    if (_current == nullptr || (size_t) (_end - _current) < padding + size)
+    {
+        // A new block starts with the alignment of any type, so it needs no padding.
+        _addBlock(size);
+        padding = 0;
+    }
+    void *memory = _current + padding;
+    _current += padding + size;
+    return memory;
+}
+
+/**
+ * @brief Move all the blocks of the given arena to this arena, leaving the other arena empty.
+ *        The memory which was allocated from the other arena is now freed with this arena.
+ * @param other The arena to move the blocks from.
+ */
+void ShapeArena::absorb(ShapeArena& other)
+{
+    // The blocks are added before the current block, so this arena keeps allocating from it.
+    _blocks.insert(_blocks.empty() ? _blocks.end() : _blocks.end() - 1, other._blocks.begin(),
+                   other._blocks.end());
+    other._blocks.clear();
+    other._current = nullptr;
+    other._end = nullptr;
+}
+
+/**
+ * @brief Free all the memory of the arena at once, keeping only it's first block for the
+ *        next allocations.
+ */
+void ShapeArena::reset()
+{
+    if (_blocks.empty())
+    {
+        return;
+    }
+    for (auto i = _blocks.begin() + 1; i != _blocks.end(); i++)
+    {
+        delete[] i -> memory;
+    }
+    _blocks.resize(1);
+    _current = _blocks.front().memory;
+    _end = _blocks.front().memory + _blocks.front().size;
+}
+
+/**
+ * @brief Free all the memory of the arena at once, including all of it's blocks.
+ */
+void ShapeArena::release()
+{
+    for (auto i = _blocks.begin(); i != _blocks.end(); i++)
+    {
+        delete[] i -> memory;
+    }
+    _blocks.clear();
+    _current = nullptr;
+    _end = nullptr;
+}
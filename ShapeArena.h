@@ -0,0 +1,113 @@
+/**
+ * @file ShapeArena.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header File for the ShapeArena Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the ShapeArena Class.
+ * Declaring the ShapeArena Class, it's methods and fields.
+ * A ShapeArena class hands out memory from large blocks by moving a pointer forward, and frees
+ * all of it's memory at once. The Shapes which the Factory creates in an arena keep their
+ * Vertices and edges inside them, so they are never freed one by one.
+ */
+
+
+#ifndef SHAPEARENA_H
+#define SHAPEARENA_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cstddef>
+#include <vector>
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief A Struct representing a block of memory of an arena.
+ */
+struct ArenaBlock
+{
+    char *memory;   // The first byte of the block.
+    size_t size;    // The size of the block in bytes.
+};
+
+
+/*-----=  Class Declarations  =-----*/
+
+
+/**
+ * @brief A Class representing an arena of memory, which allocates from large blocks and frees
+ *        all the blocks together. An arena is used by a single thread at a time.
+ */
+class ShapeArena
+{
+public:
+
+    /**
+     * @brief A Constructor for the ShapeArena, which creates an arena without any block.
+     */
+    ShapeArena();
+
+    /**
+     * @brief A Destructor for the ShapeArena, which frees all of it's blocks.
+     */
+    ~ShapeArena();
+
+    /**
+     * @brief Allocate memory of the given size from the current block of the arena, or from a
+     *        new block if the current block is full. The memory is valid until the arena frees
+     *        it's blocks.
+     * @param size The amount of bytes to allocate.
+     * @param alignment The alignment of the memory, which is at most the alignment of any type.
+     * @return A pointer to the allocated memory.
+     */
+    void *allocate(size_t const size, size_t const alignment);
+
+    /**
+     * @brief Move all the blocks of the given arena to this arena, leaving the other arena empty.
+     *        The memory which was allocated from the other arena is now freed with this arena.
+     * @param other The arena to move the blocks from.
+     */
+    void absorb(ShapeArena& other);
+
+    /**
+     * @brief Free all the memory of the arena at once, keeping only it's first block for the
+     *        next allocations.
+     */
+    void reset();
+
+    /**
+     * @brief Free all the memory of the arena at once, including all of it's blocks.
+     */
+    void release();
+
+private:
+    // ShapeArena Private Fields.
+    std::vector<ArenaBlock> _blocks;    // The blocks of the arena, where the last is the current.
+    char *_current;                     // The next free byte in the current block.
+    char *_end;                         // The end of the current block.
+
+    /**
+     * @brief Allocate a new block which has room for at least the given amount of bytes, and make
+     *        it the current block.
+     * @param size The amount of bytes which the block must hold.
+     */
+    void _addBlock(size_t const size);
+
+    // An arena owns it's blocks, so it is never copied.
+    ShapeArena(const ShapeArena& other) = delete;
+    ShapeArena& operator=(const ShapeArena& other) = delete;
+};
+
+
+#endif
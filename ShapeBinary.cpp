@@ -0,0 +1,359 @@
+/**
+ * @file ShapeBinary.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A File for the binary Shapes file format implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the binary Shapes file format implementation.
+ * Define the BinaryScene Class, it's methods and fields, and the methods which load and write
+ * binary Shapes files.
+ * A binary file holds the Shapes as columns which are read as they are, without any parsing:
+ *      1.  A header with the magic value, the version, the amount of Shapes and Points.
+ *      2.  The offset table, where entry k is the index of the first Point of Shape k, and the
+ *          last entry is the amount of Points.
+ *      3.  The X column and the Y column of all the Points, in the order of the Shapes.
+ *      4.  The type tag column, which holds the ShapeType of every Shape in a single byte.
+ * All the values are written in the byte order of the machine which wrote the file.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include "ShapeBinary.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def BINARY_MAGIC "SHAPEBIN"
+ * @brief A Macro that sets the magic value which every binary Shapes file starts with.
+ */
+#define BINARY_MAGIC "SHAPEBIN"
+
+/**
+ * @def BINARY_MAGIC_SIZE 8
+ * @brief A Macro that sets the amount of characters in the magic value.
+ */
+#define BINARY_MAGIC_SIZE 8
+
+/**
+ * @def BINARY_VERSION 1
+ * @brief A Macro that sets the version of the binary Shapes file format.
+ */
+#define BINARY_VERSION 1
+
+/**
+ * @def BINARY_BYTE_ORDER 0x01020304
+ * @brief A Macro that sets the value which detects a file written in a different byte order.
+ */
+#define BINARY_BYTE_ORDER 0x01020304
+
+/**
+ * @def BINARY_RANGE_MIN_SHAPES 16384
+ * @brief A Macro that sets the smallest amount of Shapes which a single thread loads.
+ */
+#define BINARY_RANGE_MIN_SHAPES 16384
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief A Struct representing the header of a binary Shapes file.
+ */
+struct BinaryHeader
+{
+    char magic[BINARY_MAGIC_SIZE];  // The magic value of the format.
+    uint32_t version;               // The version of the format.
+    uint32_t byteOrder;             // The byte order mark of the machine which wrote the file.
+    uint64_t shapeCount;            // The amount of Shapes in the file.
+    uint64_t pointCount;            // The amount of Points of all the Shapes in the file.
+};
+
+
+/*-----=  Shape Binary Helpers  =-----*/
+
+
+/**
+ * @brief Read a value from the given position in a column. The value is copied, so the column
+ *        does not have to be aligned.
+ * @param column The first character of the column.
+ * @param index The index of the value in the column.
+ * @return The value in the given index.
+ */
+template <typename Value>
+static inline Value readValue(const char *column, size_t const index)
+{
+    Value value;
+    memcpy(&value, column + index * sizeof(Value), sizeof(Value));
+    return value;
+}
+
+/**
+ * @brief Write the given column to the given stream.
+ * @param out The stream to write to.
+ * @param column The values to write.
+ */
+template <typename Value>
+static inline void writeColumn(std::ofstream& out, const std::vector<Value>& column)
+{
+    out.write((const char *) column.data(), (std::streamsize) (column.size() * sizeof(Value)));
+}
+
+
+/*-----=  BinaryScene Constructors  =-----*/
+
+
+/**
+ * @brief A Constructor for the BinaryScene, which creates a scene with no Shapes.
+ */
+BinaryScene::BinaryScene() : _shapeCount(0), _pointCount(0), _offsets(nullptr),
+                             _xColumn(nullptr), _yColumn(nullptr), _typeColumn(nullptr)
+{
+
+}
+
+
+/*-----=  BinaryScene Methods  =-----*/
+
+
+/**
+ * @brief Use the given span as a binary Shapes file, and check that it's layout is valid.
+ * @param input The span which holds the whole file. It must stay valid while the scene is
+ *        in use.
+ * @return true if the span holds a valid binary Shapes file, false otherwise.
+ */
+bool BinaryScene::open(const LineSpan& input)
+{
+    BinaryHeader header;
+    if (!isBinaryInput(input) || input.length < sizeof(header))
+    {
+        return false;
+    }
+    memcpy(&header, input.begin, sizeof(header));
+    if (header.version != BINARY_VERSION || header.byteOrder != BINARY_BYTE_ORDER)
+    {
+        return false;
+    }
+
+    // Every Shape and every Point takes at least a byte, so larger counts can not be valid, and
+    // the size calculation below can not overflow.
+    if (header.shapeCount > input.length || header.pointCount > input.length)
+    {
+        return false;
+    }
+    size_t offsetsSize = (size_t) (header.shapeCount + 1) * sizeof(uint64_t);
+    size_t columnSize = (size_t) header.pointCount * sizeof(CordType);
+    if (input.length != sizeof(header) + offsetsSize + 2 * columnSize + header.shapeCount)
+    {
+        return false;
+    }
+
+    _shapeCount = (ShapeIndex) header.shapeCount;
+    _pointCount = header.pointCount;
+    _offsets = input.begin + sizeof(header);
+    _xColumn = _offsets + offsetsSize;
+    _yColumn = _xColumn + columnSize;
+    _typeColumn = (const uint8_t *) (_yColumn + columnSize);
+    return true;
+}
+
+/**
+ * @brief Create the Shape in the given index of the file, and validate it.
+ * @param index The index of the Shape to read.
+ * @param shape A pointer to the created Shape in case of success, NULL Pointer otherwise.
+ * @param shapeType The type of the Shape in the given index.
+ * @param arena The arena to create the Shape in, or Null Pointer for the heap.
+ * @return PARSE_SUCCESS if the file holds a valid Shape in the given index, or the reason it
+ *         does not.
+ */
+ParseStatus BinaryScene::readShape(ShapeIndex const index, ShapeP& shape,
+                                   ShapeType& shapeType, ShapeArena *arena) const
+{
+    shape = nullptr;
+    shapeType = INVALID_TYPE;
+    if (index >= _shapeCount)
+    {
+        return PARSE_INVALID_FILE;
+    }
+
+    // The tags are checked before they become a ShapeType, where TRAPEZOID is the last type.
+    uint8_t tag = _typeColumn[index];
+    if (tag == INVALID_TYPE || tag > TRAPEZOID)
+    {
+        return PARSE_INVALID_TYPE;
+    }
+    shapeType = (ShapeType) tag;
+
+    uint64_t first = readValue<uint64_t>(_offsets, index);
+    uint64_t last = readValue<uint64_t>(_offsets, index + 1);
+    if (first > last || last > _pointCount)
+    {
+        return PARSE_INVALID_FILE;
+    }
+
+    // A Shape has at most MAX_SHAPE_VERTICES Vertices, so more Points is never a valid Shape.
+    if (last - first > MAX_SHAPE_VERTICES)
+    {
+        return PARSE_ILLEGAL_SHAPE;
+    }
+    PointVector points;
+    for (uint64_t i = first; i < last; ++i)
+    {
+        points.push_back(Point(readValue<CordType>(_xColumn, (size_t) i),
+                               readValue<CordType>(_yColumn, (size_t) i)));
+    }
+
+    shape = shapeFactory(shapeType, points, arena);
+    if (shape == nullptr || !shape -> validateShape())
+    {
+        destroyShape(shape, arena);
+        shape = nullptr;
+        return PARSE_ILLEGAL_SHAPE;
+    }
+    return PARSE_SUCCESS;
+}
+
+
+/*-----=  Shape Binary Methods  =-----*/
+
+
+/**
+ * @brief Check if the given span starts like a binary Shapes file, i.e. with the magic value.
+ * @param input The span which holds the file.
+ * @return true if the span starts with the magic value of a binary Shapes file, false otherwise.
+ */
+bool isBinaryInput(const LineSpan& input)
+{
+    return input.length >= BINARY_MAGIC_SIZE &&
+           memcmp(input.begin, BINARY_MAGIC, BINARY_MAGIC_SIZE) == 0;
+}
+
+/**
+ * @brief Create all the Shapes in the given binary Shapes file, in their order in the file,
+ *        using several worker threads. The loading stops at the first Shape which is not valid.
+ *        Every thread creates it's Shapes in it's own arena, and the arenas are then moved to
+ *        the given arena.
+ * @param input The span which holds the whole file.
+ * @param threads The largest amount of worker threads to use.
+ * @param shapes The Shapes Vector which the created Shapes are added to.
+ * @param shapeType The type of the Shape which stopped the loading.
+ * @param arena The arena to create the Shapes in, or Null Pointer for the heap.
+ * @return PARSE_SUCCESS if all the Shapes are valid, or the reason the loading stopped.
+ */
+ParseStatus loadBinaryShapes(const LineSpan& input, ThreadCount threads, ShapeVector& shapes,
+                             ShapeType& shapeType, ShapeArena *arena)
+{
+    BinaryScene scene;
+    if (!scene.open(input))
+    {
+        return PARSE_INVALID_FILE;
+    }
+    ShapeIndex count = scene.getShapeCount();
+    threads = (ThreadCount) std::max((size_t) 1, std::min((size_t) threads,
+                                                          count / BINARY_RANGE_MIN_SHAPES));
+
+    // Every Shape has a known place in the Vector, so the threads fill it directly.
+    ShapeIndex base = shapes.size();
+    shapes.resize(base + count, nullptr);
+    std::vector<ParseStatus> rangeStatus(threads, PARSE_SUCCESS);
+    std::vector<ShapeType> rangeTypes(threads, INVALID_TYPE);
+    std::vector<ShapeIndex> rangeErrors(threads, count);
+    std::vector<ShapeArena> rangeArenas(arena != nullptr ? threads : 0);
+    parallelFor(count, threads, [&](size_t begin, size_t end, ThreadCount thread)
+    {
+        ShapeArena *rangeArena = arena != nullptr ? &rangeArenas[thread] : nullptr;
+        for (ShapeIndex i = begin; i < end; ++i)
+        {
+            ParseStatus status = scene.readShape(i, shapes[base + i], rangeTypes[thread],
+                                                 rangeArena);
+            if (status != PARSE_SUCCESS)
+            {
+                rangeStatus[thread] = status;
+                rangeErrors[thread] = i;
+                return;
+            }
+        }
+    });
+
+    for (auto i = rangeArenas.begin(); i != rangeArenas.end(); i++)
+    {
+        arena -> absorb(*i);
+    }
+
+    // The ranges are in order, so the first range with an error holds the first invalid Shape.
+    // The Shapes after it are removed, the same as if they were never read.
+    for (ThreadCount thread = 0; thread < threads; ++thread)
+    {
+        if (rangeStatus[thread] != PARSE_SUCCESS)
+        {
+            for (auto i = shapes.begin() + base + rangeErrors[thread]; i != shapes.end(); i++)
+            {
+                destroyShape(*i, arena);
+            }
+            shapes.resize(base + rangeErrors[thread]);
+            shapeType = rangeTypes[thread];
+            return rangeStatus[thread];
+        }
+    }
+    return PARSE_SUCCESS;
+}
+
+/**
+ * @brief Write the given Shapes to a binary Shapes file in the given path.
+ * @param shapes The Shapes to write.
+ * @param path The path of the file to write.
+ * @return true if the file was written successfully, false otherwise.
+ */
+bool writeBinaryShapes(const ShapeVector& shapes, const char *path)
+{
+    std::vector<uint64_t> offsets;
+    std::vector<CordType> xColumn;
+    std::vector<CordType> yColumn;
+    std::vector<uint8_t> typeColumn;
+    offsets.reserve(shapes.size() + 1);
+    typeColumn.reserve(shapes.size());
+    for (auto i = shapes.begin(); i != shapes.end(); i++)
+    {
+        offsets.push_back(xColumn.size());
+        typeColumn.push_back((uint8_t) getShapeType(**i));
+        const PointVector& points = (*i) -> getPoints();
+        for (auto j = points.begin(); j != points.end(); j++)
+        {
+            xColumn.push_back(j -> getX());
+            yColumn.push_back(j -> getY());
+        }
+    }
+    offsets.push_back(xColumn.size());
+
+    BinaryHeader header;
+    memcpy(header.magic, BINARY_MAGIC, BINARY_MAGIC_SIZE);
+    header.version = BINARY_VERSION;
+    header.byteOrder = BINARY_BYTE_ORDER;
+    header.shapeCount = shapes.size();
+    header.pointCount = xColumn.size();
+
+    std::ofstream out(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+        return false;
+    }
+    out.write((const char *) &header, sizeof(header));
+    writeColumn(out, offsets);
+    writeColumn(out, xColumn);
+    writeColumn(out, yColumn);
+    writeColumn(out, typeColumn);
+    out.close();
+    return !out.fail();
+}
@@ -0,0 +1,127 @@
+/**
+ * @file ShapeBinary.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header File for the binary Shapes file format.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the binary Shapes file format.
+ * Declaring the BinaryScene Class, it's methods and fields, and the methods which load and write
+ * binary Shapes files.
+ * A binary file holds the Shapes as columns which are read as they are, without any parsing:
+ *      1.  A header with the magic value, the version, the amount of Shapes and Points.
+ *      2.  The offset table, where entry k is the index of the first Point of Shape k, and the
+ *          last entry is the amount of Points.
+ *      3.  The X column and the Y column of all the Points, in the order of the Shapes.
+ *      4.  The type tag column, which holds the ShapeType of every Shape in a single byte.
+ * All the values are written in the byte order of the machine which wrote the file.
+ */
+
+
+#ifndef SHAPEBINARY_H
+#define SHAPEBINARY_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cstdint>
+#include "ShapeFactory.h"
+#include "ShapeParser.h"
+#include "InputReader.h"
+#include "Parallel.h"
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class representing a binary Shapes file which is already in memory.
+ *        Any Shape in the file is read by it's index, without reading the Shapes before it.
+ */
+class BinaryScene
+{
+public:
+
+    /**
+     * @brief A Constructor for the BinaryScene, which creates a scene with no Shapes.
+     */
+    BinaryScene();
+
+    /**
+     * @brief Use the given span as a binary Shapes file, and check that it's layout is valid.
+     * @param input The span which holds the whole file. It must stay valid while the scene is
+     *        in use.
+     * @return true if the span holds a valid binary Shapes file, false otherwise.
+     */
+    bool open(const LineSpan& input);
+
+    /**
+     * @brief Returns the amount of Shapes in the file.
+     * @return The amount of Shapes in the file.
+     */
+    ShapeIndex getShapeCount() const { return _shapeCount; };
+
+    /**
+     * @brief Create the Shape in the given index of the file, and validate it.
+     * @param index The index of the Shape to read.
+     * @param shape A pointer to the created Shape in case of success, NULL Pointer otherwise.
+     * @param shapeType The type of the Shape in the given index.
+     * @param arena The arena to create the Shape in, or Null Pointer for the heap.
+     * @return PARSE_SUCCESS if the file holds a valid Shape in the given index, or the reason it
+     *         does not.
+     */
+    ParseStatus readShape(ShapeIndex const index, ShapeP& shape, ShapeType& shapeType,
+                          ShapeArena *arena) const;
+
+private:
+    // BinaryScene Private Fields.
+    ShapeIndex _shapeCount;      // The amount of Shapes in the file.
+    uint64_t _pointCount;        // The amount of Points of all the Shapes in the file.
+    const char *_offsets;        // The offset table of the file.
+    const char *_xColumn;        // The X coordinates of all the Points.
+    const char *_yColumn;        // The Y coordinates of all the Points.
+    const uint8_t *_typeColumn;  // The type tag of every Shape.
+};
+
+
+/*-----=  Shape Binary Methods  =-----*/
+
+
+/**
+ * @brief Check if the given span starts like a binary Shapes file, i.e. with the magic value.
+ * @param input The span which holds the file.
+ * @return true if the span starts with the magic value of a binary Shapes file, false otherwise.
+ */
+bool isBinaryInput(const LineSpan& input);
+
+/**
+ * @brief Create all the Shapes in the given binary Shapes file, in their order in the file,
+ *        using several worker threads. The loading stops at the first Shape which is not valid.
+ *        Every thread creates it's Shapes in it's own arena, and the arenas are then moved to
+ *        the given arena.
+ * @param input The span which holds the whole file.
+ * @param threads The largest amount of worker threads to use.
+ * @param shapes The Shapes Vector which the created Shapes are added to.
+ * @param shapeType The type of the Shape which stopped the loading.
+ * @param arena The arena to create the Shapes in, or Null Pointer for the heap.
+ * @return PARSE_SUCCESS if all the Shapes are valid, or the reason the loading stopped.
+ */
+ParseStatus loadBinaryShapes(const LineSpan& input, ThreadCount threads, ShapeVector& shapes,
+                             ShapeType& shapeType, ShapeArena *arena);
+
+/**
+ * @brief Write the given Shapes to a binary Shapes file in the given path.
+ * @param shapes The Shapes to write.
+ * @param path The path of the file to write.
+ * @return true if the file was written successfully, false otherwise.
+ */
+bool writeBinaryShapes(const ShapeVector& shapes, const char *path);
+
+
+#endif
@@ -19,6 +19,7 @@
 /*-----=  Includes  =-----*/
 
 
+#include <new>
 #include "ShapeFactory.h"
 
 
@@ -37,6 +38,51 @@
  */
 #define TRAPEZOID_TYPE_FLAG 't'
 
+// Every Shape type keeps all of it's Vertices inside the Shape object.
+static_assert(TRIANGLE_POINTS <= MAX_SHAPE_VERTICES && TRAPEZOID_POINTS <= MAX_SHAPE_VERTICES,
+              "A Shape type has more Vertices than a Shape can hold.");
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief A Struct representing the registration of a Shape type: the flag of the type in a line
+ *        of the input, and the name of the type in the error messages.
+ */
+struct ShapeTypeInfo
+{
+    char flag;          // The flag of the type in a line of the input.
+    const char *name;   // The name of the type in the error messages.
+};
+
+/**
+ * @brief The registry of the Shape types, in the order of the ShapeType Enum. A Shape keeps only
+ *        it's ShapeType, which is resolved against this registry when a name is needed.
+ */
+static const ShapeTypeInfo SHAPE_TYPES[SHAPE_TYPE_COUNT] =
+{
+    {'\0', ""},                                  // INVALID_TYPE.
+    {TRIANGLE_TYPE_FLAG, TRIANGLE_TYPE},         // TRIANGLE.
+    {TRAPEZOID_TYPE_FLAG, TRAPEZOID_TYPE}        // TRAPEZOID.
+};
+
+
+/*-----=  Shape Factory Helpers  =-----*/
+
+
+/**
+ * @brief Create a Shape of the given type in the given arena, using it's constructor.
+ * @param points The Points which create the Shape to create.
+ * @param arena The arena to create the Shape in.
+ * @return Pointer for the created Shape.
+ */
+template <typename T>
+static ShapeP createInArena(const PointVector& points, ShapeArena& arena)
+{
+    return new (arena.allocate(sizeof(T), alignof(T))) T(points);
+}
+
 
 /*-----=  Shape Factory Methods  =-----*/
 
@@ -48,17 +94,39 @@
  */
 ShapeType getShapeType(const char typeFlag)
 {
-    switch (typeFlag)
+    for (int type = TRIANGLE; type < SHAPE_TYPE_COUNT; type++)
     {
-        case TRIANGLE_TYPE_FLAG:
-            return TRIANGLE;
+        if (SHAPE_TYPES[type].flag == typeFlag)
+        {
+            return (ShapeType) type;
+        }
+    }
+    return INVALID_TYPE;
+}
 
-        case TRAPEZOID_TYPE_FLAG:
-            return TRAPEZOID;
+/**
+ * @brief Determine the type of the given Shape.
+ * @param shape The Shape to check.
+ * @return A ShapeType representing the given Shape's type.
+ */
+ShapeType getShapeType(const Shape& shape)
+{
+    return shape.getType();
+}
 
-        default:
-            return INVALID_TYPE;
+/**
+ * @brief Returns the name of the given Shape's type, as it appears in the error messages.
+ *        The name is made from the registry of the Shape types only when it is needed.
+ * @param shapeType A ShapeType which represent the specific type of the Shape.
+ * @return The name of the Shape's type.
+ */
+ShapeName getShapeName(ShapeType const shapeType)
+{
+    if (shapeType >= SHAPE_TYPE_COUNT)
+    {
+        return ShapeName();
     }
+    return ShapeName(SHAPE_TYPES[shapeType].name);
 }
 
 /**
@@ -88,3 +156,47 @@ ShapeP shapeFactory(ShapeType const shapeType, const PointVector& points)
 
     return pShape;
 }
+
+/**
+ * @brief Create a Shape object of a specific type with the given type and coordinates in the
+ *        given arena. The Shape, which holds it's Vertices and it's edges, is carved out of the
+ *        blocks of the arena, and it is freed together with the arena instead of one by one.
+ *        Without an arena the Shape is created in the heap, the same as the Factory above.
+ * @param shapeType A ShapeType which represent the specific type of the Shape to create.
+ * @param points The Points which create the Shape to create.
+ * @param arena The arena to create the Shape in, or Null Pointer for the heap.
+ * @return Pointer for the created Shape or Null Pointer in case of an error.
+ */
+ShapeP shapeFactory(ShapeType const shapeType, const PointVector& points, ShapeArena *arena)
+{
+    if (arena == nullptr)
+    {
+        return shapeFactory(shapeType, points);
+    }
+
+    switch (shapeType)
+    {
+        case TRIANGLE:
+            return createInArena<Triangle>(points, *arena);
+
+        case TRAPEZOID:
+            return createInArena<Trapezoid>(points, *arena);
+
+        default:
+            return nullptr;
+    }
+}
+
+/**
+ * @brief Free a Shape which was created by the Factory. A Shape in an arena is freed only with
+ *        the arena, so nothing is done for it here.
+ * @param shape The Shape to free, or Null Pointer.
+ * @param arena The arena which the Shape was created in, or Null Pointer for the heap.
+ */
+void destroyShape(ShapeP shape, ShapeArena *arena)
+{
+    if (arena == nullptr)
+    {
+        delete shape;
+    }
+}
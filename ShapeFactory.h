@@ -27,6 +27,7 @@
 #include "Shape.h"
 #include "Triangle.h"
 #include "Trapezoid.h"
+#include "ShapeArena.h"
 
 
 /*-----=  Type Definitions  =-----*/
@@ -37,20 +38,30 @@
  */
 typedef Shape *ShapeP;
 
+/**
+ * @brief ShapeVector is the ShapeP Vector which is the Container of the pointers for Shapes.
+ */
+typedef std::vector<ShapeP> ShapeVector;
 
-/*-----=  Enums  =-----*/
-
+/**
+ * @brief ShapeIndex is the position of a Shape in the Shapes Vector, i.e. it's order in the input.
+ */
+typedef ShapeVector::size_type ShapeIndex;
 
 /**
- * @brief An Enum for the different types of Shapes.
+ * @brief A Struct representing a pair of Shapes by their indices, where first < second.
  */
-enum ShapeType
+struct ShapePair
 {
-    INVALID_TYPE,
-    TRIANGLE,
-    TRAPEZOID
+    ShapeIndex first;   // The index of the first Shape in the pair.
+    ShapeIndex second;  // The index of the second Shape in the pair.
 };
 
+/**
+ * @brief PairVector is a Vector of pairs of Shapes.
+ */
+typedef std::vector<ShapePair> PairVector;
+
 
 /*-----=  Shape Factory Methods  =-----*/
 
@@ -62,6 +73,21 @@ enum ShapeType
  */
 ShapeType getShapeType(const char typeFlag);
 
+/**
+ * @brief Determine the type of the given Shape.
+ * @param shape The Shape to check.
+ * @return A ShapeType representing the given Shape's type.
+ */
+ShapeType getShapeType(const Shape& shape);
+
+/**
+ * @brief Returns the name of the given Shape's type, as it appears in the error messages.
+ *        The name is made from the registry of the Shape types only when it is needed.
+ * @param shapeType A ShapeType which represent the specific type of the Shape.
+ * @return The name of the Shape's type.
+ */
+ShapeName getShapeName(ShapeType const shapeType);
+
 /**
  * @brief Create a Shape object of a specific type with the given type and coordinates.
  *        The Factory returns a pointer for the created Shape or Null Pointer in case of an error.
@@ -71,5 +97,25 @@ ShapeType getShapeType(const char typeFlag);
  */
 ShapeP shapeFactory(ShapeType const shapeType, const PointVector& points);
 
+/**
+ * @brief Create a Shape object of a specific type with the given type and coordinates in the
+ *        given arena. The Shape, which holds it's Vertices and it's edges, is carved out of the
+ *        blocks of the arena, and it is freed together with the arena instead of one by one.
+ *        Without an arena the Shape is created in the heap, the same as the Factory above.
+ * @param shapeType A ShapeType which represent the specific type of the Shape to create.
+ * @param points The Points which create the Shape to create.
+ * @param arena The arena to create the Shape in, or Null Pointer for the heap.
+ * @return Pointer for the created Shape or Null Pointer in case of an error.
+ */
+ShapeP shapeFactory(ShapeType const shapeType, const PointVector& points, ShapeArena *arena);
+
+/**
+ * @brief Free a Shape which was created by the Factory. A Shape in an arena is freed only with
+ *        the arena, so nothing is done for it here.
+ * @param shape The Shape to free, or Null Pointer.
+ * @param arena The arena which the Shape was created in, or Null Pointer for the heap.
+ */
+void destroyShape(ShapeP shape, ShapeArena *arena);
+
 
 #endif
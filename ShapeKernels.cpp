@@ -0,0 +1,499 @@
+/**
+ * @file ShapeKernels.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A File for the intersection kernels of the Shapes implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the intersection kernels of the Shapes implementation.
+ * Define the kernels which check a pair of Shapes with a known amount of Vertices in each Shape,
+ * and the table which chooses the kernel for a pair of Shape types.
+ * The kernels use the same calculations in the same order as the Shape Class, so they give the
+ * same results.
+ * A pair of Trapezoids which their bases are parallel to the X axis is first checked by it's
+ * slab, i.e. the band of Y values which both Trapezoids cover, where every leg is a line of X by
+ * Y. Only pairs which are far from touching, compared to the rounding of the kernel, are decided
+ * this way, so these checks give the same results as the kernel.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <cmath>
+#include "ShapeKernels.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def FIRST_VERTEX 0
+ * @brief A Macro that sets the index of the first Vertex of a Shape.
+ */
+#define FIRST_VERTEX 0
+
+/**
+ * @def SLAB_TOLERANCE 1e-9
+ * @brief A Macro that sets the smallest value of an edge line in a Vertex which is not on it, as a
+ *        part of the squared size of the coordinates, which a Trapezoid slab check relies on.
+ *        The rounding of the kernel is smaller by several orders, so a Vertex which is farther
+ *        than it from every line is on the same side in the kernel as in exact arithmetic.
+ */
+#define SLAB_TOLERANCE 1e-9
+
+/**
+ * @def SLAB_MIN_SCALE 1e-60
+ * @brief A Macro that sets the smallest size of the coordinates of a pair of Trapezoids which are
+ *        checked by their slabs, so the values of the kernel never underflow.
+ */
+#define SLAB_MIN_SCALE 1e-60
+
+/**
+ * @def SLAB_MAX_SCALE 1e60
+ * @brief A Macro that sets the largest size of the coordinates of a pair of Trapezoids which are
+ *        checked by their slabs, so the values of the kernel never overflow.
+ */
+#define SLAB_MAX_SCALE 1e60
+
+/**
+ * @def FIRST_BASE 0
+ * @brief A Macro that sets the index of the first Vertex of the first base of a Trapezoid.
+ */
+#define FIRST_BASE 0
+
+/**
+ * @def SECOND_BASE 2
+ * @brief A Macro that sets the index of the first Vertex of the second base of a Trapezoid.
+ */
+#define SECOND_BASE 2
+
+
+/*-----=  Kernel Helpers  =-----*/
+
+
+/**
+ * @brief Copy the Vertices and the edge lines of the given Shape to the given fixed size arrays.
+ * @param shape The Shape to copy, which has exactly N Vertices.
+ * @param x The array of the X coordinates to fill.
+ * @param y The array of the Y coordinates to fill.
+ * @param edges The array of the edge lines to fill.
+ */
+template <ShapeSize N>
+static inline void loadVertices(const ShapeView& shape, CordType (&x)[N], CordType (&y)[N],
+                                EdgeLine (&edges)[N])
+{
+    for (ShapeSize i = FIRST_VERTEX; i < N; i++)
+    {
+        x[i] = shape.getX(i);
+        y[i] = shape.getY(i);
+        edges[i] = shape.getEdge(i);
+    }
+}
+
+/**
+ * @brief Calculate the side of every Vertex of a Shape according to every edge of another Shape.
+ * @param x The X coordinates of the N Vertices of the Shape.
+ * @param y The Y coordinates of the N Vertices of the Shape.
+ * @param edges The lines of the M edges of the other Shape.
+ * @param sides The values to fill, where the value of the line of edge k in Vertex i is kept in
+ *        sides[k][i].
+ */
+template <ShapeSize N, ShapeSize M>
+static inline void calculateSides(const CordType (&x)[N], const CordType (&y)[N],
+                                  const EdgeLine (&edges)[M], CordType (&sides)[M][N])
+{
+    for (ShapeSize k = FIRST_VERTEX; k < M; k++)
+    {
+        for (ShapeSize i = FIRST_VERTEX; i < N; i++)
+        {
+            sides[k][i] = edges[k].valueAt(x[i], y[i]);
+        }
+    }
+}
+
+/**
+ * @brief Determine if an edge of the first Shape crosses an edge of the second Shape, using the
+ *        sides of the Vertices of each Shape according to the edges of the other Shape.
+ * @param aSides The value of the line of edge k of the second Shape in Vertex i of the first
+ *        Shape is in aSides[k][i].
+ * @param bSides The value of the line of edge i of the first Shape in Vertex k of the second
+ *        Shape is in bSides[i][k].
+ * @return true if an edge of the first Shape crosses an edge of the second Shape, false otherwise.
+ */
+template <ShapeSize N, ShapeSize M>
+static inline bool edgesCross(const CordType (&aSides)[M][N], const CordType (&bSides)[N][M])
+{
+    for (ShapeSize i = FIRST_VERTEX; i < N; i++)
+    {
+        ShapeSize j = (i + 1) % N;
+        for (ShapeSize k = FIRST_VERTEX; k < M; k++)
+        {
+            ShapeSize l = (k + 1) % M;
+            if (aSides[k][i] * aSides[k][j] < 0 && bSides[i][k] * bSides[i][l] < 0)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Determine if any Vertex of a Shape is inside another Shape, checking all the Vertices
+ *        together, using their sides according to the edges of the other Shape.
+ * @param sides The value of the line of edge k of the other Shape in Vertex i of the Shape is in
+ *        sides[k][i].
+ * @return true if a Vertex of the Shape is inside the other Shape, false otherwise.
+ */
+template <ShapeSize N, ShapeSize M>
+static inline bool hasVertexInside(const CordType (&sides)[M][N])
+{
+    // 'inside' holds the Vertices which appeared on the same side of all the edges so far, and
+    // 'firstSides' holds the side of every Vertex according to the first edge.
+    VertexMask inside = ((VertexMask) 1 << N) - 1;
+    VertexMask firstSides = 0;
+    for (ShapeSize k = FIRST_VERTEX; k < M; k++)
+    {
+        VertexMask edgeSides = 0;
+        for (ShapeSize i = FIRST_VERTEX; i < N; i++)
+        {
+            // True for right-side, false for left-side.
+            edgeSides |= (VertexMask) (sides[k][i] < 0) << i;
+        }
+        if (k == FIRST_VERTEX)
+        {
+            firstSides = edgeSides;
+        }
+        else
+        {
+            inside &= ~(edgeSides ^ firstSides);
+            if (inside == 0)
+            {
+                return false;
+            }
+        }
+    }
+    return inside != 0;
+}
+
+
+/*-----=  Trapezoid Slab Helpers  =-----*/
+
+
+/**
+ * @brief Determine if both bases of the given Trapezoid are exactly parallel to the X axis.
+ *        The validation of a Trapezoid allows a small slope, which the slab checks do not.
+ * @param shape The Trapezoid to check.
+ * @return true if both bases are parallel to the X axis, false otherwise.
+ */
+static inline bool hasFlatBases(const ShapeView& shape)
+{
+    return shape.getY(FIRST_BASE) == shape.getY(FIRST_BASE + 1) &&
+           shape.getY(SECOND_BASE) == shape.getY(SECOND_BASE + 1);
+}
+
+/**
+ * @brief Determine if the legs of the given Trapezoid do not cross each other, i.e. the Trapezoid
+ *        is not a bow-tie of two triangles. The legs are ordered the same way along both bases.
+ * @param shape The Trapezoid to check, which bases are parallel to the X axis.
+ * @return true if the legs do not cross, false otherwise.
+ */
+static inline bool hasSeparateLegs(const ShapeView& shape)
+{
+    return (shape.getX(FIRST_BASE + 1) - shape.getX(FIRST_BASE)) *
+           (shape.getX(SECOND_BASE) - shape.getX(SECOND_BASE + 1)) > 0;
+}
+
+/**
+ * @brief Determine if both legs of the given Trapezoid are exactly parallel to the Y axis, i.e.
+ *        the Trapezoid is a rectangle with edges parallel to the axes.
+ * @param shape The Trapezoid to check, which bases are parallel to the X axis.
+ * @return true if both legs are parallel to the Y axis, false otherwise.
+ */
+static inline bool hasUprightLegs(const ShapeView& shape)
+{
+    return shape.getX(FIRST_BASE + 1) == shape.getX(SECOND_BASE) &&
+           shape.getX(SECOND_BASE + 1) == shape.getX(FIRST_BASE);
+}
+
+/**
+ * @brief Returns the length of the shortest base of the given Trapezoid, or it's height if the
+ *        height is shorter. The value of an edge line in a Vertex is the distance of the Vertex
+ *        from the line along one axis, times the length of the edge along the other axis, which
+ *        is at least this length.
+ * @param shape The Trapezoid, which bases are parallel to the X axis.
+ * @return The shortest length of the Trapezoid.
+ */
+static inline CordType shortestLength(const ShapeView& shape)
+{
+    CordType firstBase = fabs(shape.getX(FIRST_BASE + 1) - shape.getX(FIRST_BASE));
+    CordType secondBase = fabs(shape.getX(SECOND_BASE + 1) - shape.getX(SECOND_BASE));
+    CordType height = fabs(shape.getY(SECOND_BASE) - shape.getY(FIRST_BASE));
+    return std::min(std::min(firstBase, secondBase), height);
+}
+
+/**
+ * @brief Returns the largest absolute value of a coordinate in the given Bounding Box.
+ * @param box The Bounding Box.
+ * @return The largest absolute value of a coordinate.
+ */
+static inline CordType coordinateScale(const BoundingBox& box)
+{
+    return std::max(std::max(fabs(box.getMinX()), fabs(box.getMaxX())),
+                    std::max(fabs(box.getMinY()), fabs(box.getMaxY())));
+}
+
+/**
+ * @brief Calculate the X value of the given leg of a Trapezoid in the given Y value.
+ * @param shape The Trapezoid, which bases are parallel to the X axis.
+ * @param from The index of the Vertex which the leg starts at.
+ * @param to The index of the Vertex which the leg ends at.
+ * @param y The Y value, which is inside the band of the Trapezoid.
+ * @return The X value of the leg.
+ */
+static inline CordType legAt(const ShapeView& shape, ShapeSize const from, ShapeSize const to,
+                             CordType const y)
+{
+    CordType x1 = shape.getX(from);
+    CordType y1 = shape.getY(from);
+    return x1 + ((shape.getX(to) - x1) * (y - y1)) / (shape.getY(to) - y1);
+}
+
+/**
+ * @brief Calculate the smallest and the largest X values of a Trapezoid in the given Y value.
+ * @param shape The Trapezoid, which bases are parallel to the X axis.
+ * @param y The Y value, which is inside the band of the Trapezoid.
+ * @param left The smallest X value to fill.
+ * @param right The largest X value to fill.
+ */
+static inline void slabAt(const ShapeView& shape, CordType const y, CordType& left,
+                          CordType& right)
+{
+    // The legs of a Trapezoid are the edges between it's two bases.
+    CordType firstLeg = legAt(shape, FIRST_BASE + 1, SECOND_BASE, y);
+    CordType secondLeg = legAt(shape, SECOND_BASE + 1, FIRST_BASE, y);
+    left = std::min(firstLeg, secondLeg);
+    right = std::max(firstLeg, secondLeg);
+}
+
+/**
+ * @brief Determine if a gap between a Vertex and an edge line along one axis is far enough, i.e.
+ *        it gives the line a value larger than the tolerance in the Vertex.
+ * @param gap The gap along one axis.
+ * @param length The shortest length of the Trapezoids.
+ * @param tolerance The smallest value of a line which the slab checks rely on.
+ * @return true if the gap is far enough, false otherwise.
+ */
+static inline bool isFar(CordType const gap, CordType const length, CordType const tolerance)
+{
+    return fabs(gap) * length > tolerance;
+}
+
+/**
+ * @brief Determine if the given X value is inside the given range of X values, far from both of
+ *        it's ends.
+ * @param x The X value to check.
+ * @param left The smallest X value of the range.
+ * @param right The largest X value of the range.
+ * @param length The shortest length of the Trapezoids.
+ * @param tolerance The smallest value of a line which the slab checks rely on.
+ * @return true if the X value is far inside the range, false otherwise.
+ */
+static inline bool isInside(CordType const x, CordType const left, CordType const right,
+                            CordType const length, CordType const tolerance)
+{
+    return left < x && x < right && isFar(x - left, length, tolerance) &&
+           isFar(right - x, length, tolerance);
+}
+
+/**
+ * @brief Determine if the ranges of two Trapezoids in a Y value at the end of their slab cross,
+ *        i.e. a Vertex of one Trapezoid is inside the range of the other, or a leg of one
+ *        Trapezoid is inside the base of the other. The Y value is a base of one Trapezoid, so
+ *        either case means that the Trapezoids intersect.
+ * @param firstLeft The smallest X value of the first Trapezoid.
+ * @param firstRight The largest X value of the first Trapezoid.
+ * @param secondLeft The smallest X value of the second Trapezoid.
+ * @param secondRight The largest X value of the second Trapezoid.
+ * @param length The shortest length of the Trapezoids.
+ * @param tolerance The smallest value of a line which the slab checks rely on.
+ * @return true if the ranges cross far from their ends, false otherwise.
+ */
+static inline bool slabsCross(CordType const firstLeft, CordType const firstRight,
+                              CordType const secondLeft, CordType const secondRight,
+                              CordType const length, CordType const tolerance)
+{
+    return isInside(firstLeft, secondLeft, secondRight, length, tolerance) ||
+           isInside(firstRight, secondLeft, secondRight, length, tolerance) ||
+           isInside(secondLeft, firstLeft, firstRight, length, tolerance) ||
+           isInside(secondRight, firstLeft, firstRight, length, tolerance);
+}
+
+/**
+ * @brief Determine if a range of X values ends far before another range starts.
+ * @param right The largest X value of the first range.
+ * @param left The smallest X value of the second range.
+ * @param length The shortest length of the Trapezoids.
+ * @param tolerance The smallest value of a line which the slab checks rely on.
+ * @return true if the first range is far before the second range, false otherwise.
+ */
+static inline bool isBefore(CordType const right, CordType const left, CordType const length,
+                            CordType const tolerance)
+{
+    return right < left && isFar(left - right, length, tolerance);
+}
+
+
+/*-----=  Kernels  =-----*/
+
+
+/**
+ * @brief The kernel for a Shape with N Vertices and a Shape with M Vertices.
+ *        The side of every Vertex according to every edge of the other Shape is calculated
+ *        once, and both the edge crossing and the sub-set checks use it.
+ * @param first The first Shape to check, which has exactly N Vertices.
+ * @param second The second Shape to check, which has exactly M Vertices.
+ * @return true if the Shapes intersect, false otherwise.
+ */
+template <ShapeSize N, ShapeSize M>
+static bool intersectKernel(const ShapeView& first, const ShapeView& second)
+{
+    CordType ax[N], ay[N];
+    CordType bx[M], by[M];
+    EdgeLine aEdges[N];
+    EdgeLine bEdges[M];
+    loadVertices(first, ax, ay, aEdges);
+    loadVertices(second, bx, by, bEdges);
+
+    CordType aSides[M][N];
+    CordType bSides[N][M];
+    calculateSides(ax, ay, bEdges, aSides);
+    calculateSides(bx, by, aEdges, bSides);
+    return edgesCross(aSides, bSides) || hasVertexInside(aSides) || hasVertexInside(bSides);
+}
+
+/**
+ * @brief The kernel for Shapes of any amount of Vertices, which runs the checks of the views.
+ * @param first The first Shape to check.
+ * @param second The second Shape to check.
+ * @return true if the Shapes intersect, false otherwise.
+ */
+static bool generalKernel(const ShapeView& first, const ShapeView& second)
+{
+    return first.overlaps(second);
+}
+
+/**
+ * @brief The kernel for two Trapezoids, which uses the bases of the Trapezoids when they are
+ *        parallel to the X axis, their legs do not cross and their Y values are far apart. Two
+ *        rectangles intersect exactly when their ranges of X values overlap. Other Trapezoids
+ *        intersect when their ranges cross at an end of their slab, and do not intersect when
+ *        one is far before the other at both ends. Any other pair, including a bow-tie Trapezoid
+ *        which legs cross, is checked by the kernel of two Shapes with 4 Vertices.
+ * @param first The first Trapezoid to check.
+ * @param second The second Trapezoid to check.
+ * @return true if the Trapezoids intersect, false otherwise.
+ */
+static bool trapezoidKernel(const ShapeView& first, const ShapeView& second)
+{
+    if (!hasFlatBases(first) || !hasFlatBases(second) || !hasSeparateLegs(first) ||
+        !hasSeparateLegs(second))
+    {
+        return intersectKernel<TRAPEZOID_POINTS, TRAPEZOID_POINTS>(first, second);
+    }
+    const BoundingBox& firstBox = first.getBoundingBox();
+    const BoundingBox& secondBox = second.getBoundingBox();
+    CordType scale = std::max(coordinateScale(firstBox), coordinateScale(secondBox));
+    CordType length = std::min(shortestLength(first), shortestLength(second));
+    CordType tolerance = SLAB_TOLERANCE * scale * scale;
+    CordType bottom = std::max(firstBox.getMinY(), secondBox.getMinY());
+    CordType top = std::min(firstBox.getMaxY(), secondBox.getMaxY());
+
+    // A Vertex on the line of a base of the other Trapezoid is left to the kernel.
+    if (scale < SLAB_MIN_SCALE || scale > SLAB_MAX_SCALE || bottom >= top ||
+        !isFar(first.getY(FIRST_BASE) - second.getY(FIRST_BASE), length, tolerance) ||
+        !isFar(first.getY(FIRST_BASE) - second.getY(SECOND_BASE), length, tolerance) ||
+        !isFar(first.getY(SECOND_BASE) - second.getY(FIRST_BASE), length, tolerance) ||
+        !isFar(first.getY(SECOND_BASE) - second.getY(SECOND_BASE), length, tolerance))
+    {
+        return intersectKernel<TRAPEZOID_POINTS, TRAPEZOID_POINTS>(first, second);
+    }
+
+    if (hasUprightLegs(first) && hasUprightLegs(second))
+    {
+        if (isFar(firstBox.getMinX() - secondBox.getMinX(), length, tolerance) &&
+            isFar(firstBox.getMinX() - secondBox.getMaxX(), length, tolerance) &&
+            isFar(firstBox.getMaxX() - secondBox.getMinX(), length, tolerance) &&
+            isFar(firstBox.getMaxX() - secondBox.getMaxX(), length, tolerance))
+        {
+            return firstBox.getMinX() < secondBox.getMaxX() &&
+                   secondBox.getMinX() < firstBox.getMaxX();
+        }
+        return intersectKernel<TRAPEZOID_POINTS, TRAPEZOID_POINTS>(first, second);
+    }
+
+    CordType firstLeft, firstRight, secondLeft, secondRight;
+    slabAt(first, bottom, firstLeft, firstRight);
+    slabAt(second, bottom, secondLeft, secondRight);
+    if (slabsCross(firstLeft, firstRight, secondLeft, secondRight, length, tolerance))
+    {
+        return true;
+    }
+    bool firstBefore = isBefore(firstRight, secondLeft, length, tolerance);
+    bool secondBefore = isBefore(secondRight, firstLeft, length, tolerance);
+
+    slabAt(first, top, firstLeft, firstRight);
+    slabAt(second, top, secondLeft, secondRight);
+    if (slabsCross(firstLeft, firstRight, secondLeft, secondRight, length, tolerance))
+    {
+        return true;
+    }
+    // The gaps between the legs change linearly along the slab, so a Trapezoid which is far
+    // before the other at both ends of the slab is far before it all along the slab.
+    if ((firstBefore && isBefore(firstRight, secondLeft, length, tolerance)) ||
+        (secondBefore && isBefore(secondRight, firstLeft, length, tolerance)))
+    {
+        return false;
+    }
+    return intersectKernel<TRAPEZOID_POINTS, TRAPEZOID_POINTS>(first, second);
+}
+
+/**
+ * @brief The kernel of every pair of Shape types, where the row is the type of the first Shape
+ *        and the column is the type of the second Shape.
+ */
+static const IntersectionKernel KERNELS[SHAPE_TYPE_COUNT][SHAPE_TYPE_COUNT] =
+{
+    // INVALID_TYPE.
+    {generalKernel, generalKernel, generalKernel},
+    // TRIANGLE.
+    {generalKernel, intersectKernel<TRIANGLE_POINTS, TRIANGLE_POINTS>,
+     intersectKernel<TRIANGLE_POINTS, TRAPEZOID_POINTS>},
+    // TRAPEZOID.
+    {generalKernel, intersectKernel<TRAPEZOID_POINTS, TRIANGLE_POINTS>,
+     trapezoidKernel}
+};
+
+
+/*-----=  Kernel Methods  =-----*/
+
+
+/**
+ * @brief Determine if the given Shapes intersect, using the kernel of their pair of types.
+ *        The result is the same as checking if an edge of one Shape crosses an edge of the
+ *        other Shape, or one Shape is a sub-set of the other Shape.
+ * @param first The first Shape to check.
+ * @param second The second Shape to check.
+ * @return true if the Shapes intersect, false otherwise.
+ */
+bool intersectShapes(const ShapeView& first, const ShapeView& second)
+{
+    return KERNELS[first.getType()][second.getType()](first, second);
+}
@@ -0,0 +1,75 @@
+/**
+ * @file ShapeKernels.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header File for the intersection kernels of the Shapes.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the intersection kernels of the Shapes.
+ * Declaring the side test which the intersection checks are built from, and the method which
+ * checks a pair of Shapes using the kernel of their pair of types.
+ * Every kernel is compiled for a known amount of Vertices in each of the two Shapes, so all of
+ * it's loops have a fixed length, and no virtual method is called for the Shapes.
+ */
+
+
+#ifndef SHAPEKERNELS_H
+#define SHAPEKERNELS_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include "ShapeStore.h"
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief IntersectionKernel is a method which determines if two Shapes intersect, i.e. an edge
+ *        of one Shape crosses an edge of the other Shape, or one Shape is a sub-set of the other.
+ */
+typedef bool (*IntersectionKernel)(const ShapeView& first, const ShapeView& second);
+
+
+/*-----=  Kernel Calculations  =-----*/
+
+
+/**
+ * @brief Determine if the given edge crosses the given line of another edge, i.e. the two Points
+ *        of the edge are on different sides of the line.
+ * @param x1 The X coordinate of the first Point in the edge.
+ * @param y1 The Y coordinate of the first Point in the edge.
+ * @param x2 The X coordinate of the second Point in the edge.
+ * @param y2 The Y coordinate of the second Point in the edge.
+ * @param line The line of the other edge.
+ * @return true if the edge crosses the line, false otherwise.
+ */
+inline bool edgesIntersectHelper(CordType const x1, CordType const y1, CordType const x2,
+                                 CordType const y2, const EdgeLine& line)
+{
+    return line.valueAt(x1, y1) * line.valueAt(x2, y2) < 0;
+}
+
+
+/*-----=  Kernel Methods  =-----*/
+
+
+/**
+ * @brief Determine if the given Shapes intersect, using the kernel of their pair of types.
+ *        The result is the same as checking if an edge of one Shape crosses an edge of the
+ *        other Shape, or one Shape is a sub-set of the other Shape.
+ * @param first The first Shape to check.
+ * @param second The second Shape to check.
+ * @return true if the Shapes intersect, false otherwise.
+ */
+bool intersectShapes(const ShapeView& first, const ShapeView& second);
+
+
+#endif
@@ -0,0 +1,584 @@
+/**
+ * @file ShapeParser.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A File for the Shape Parser implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the Shape Parser implementation.
+ * A line holds the type of the Shape followed by it's coordinates, separated by tabs.
+ * The Parser scans a line once, without copying it and without allocating memory, and reports
+ * errors using status codes instead of exceptions.
+ * Most coordinates are short decimal numbers, which are converted exactly by a single floating
+ * point operation on an integer mantissa and an exact power of 10. Any other number is left to
+ * strtod, so the accepted inputs are exactly the inputs that std::stod accepts.
+ * A large input is split to ranges of whole lines which are parsed together by several threads,
+ * and the Shapes of the ranges are joined in their order in the input.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "ShapeParser.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def COORDINATES_SEPARATOR '\t'
+ * @brief A Macro that sets the flag representing the separator between the Shape's coordinates.
+ */
+#define COORDINATES_SEPARATOR '\t'
+
+/**
+ * @def SHAPE_TYPE_INDEX 0
+ * @brief A Macro that sets the index of the Shape's type in the given line from a file.
+ */
+#define SHAPE_TYPE_INDEX 0
+
+/**
+ * @def NEW_LINE '\n'
+ * @brief A Macro that sets the character which separates the lines of the input.
+ */
+#define NEW_LINE '\n'
+
+/**
+ * @def EMPTY_LINE_LENGTH 0
+ * @brief A Macro that sets the length of an empty line in the input.
+ */
+#define EMPTY_LINE_LENGTH 0
+
+/**
+ * @def PARSE_RANGE_MIN_SIZE 1048576
+ * @brief A Macro that sets the smallest amount of characters which a single thread parses.
+ *        Smaller inputs are parsed by fewer threads, since starting a thread costs more than
+ *        parsing a few lines.
+ */
+#define PARSE_RANGE_MIN_SIZE 1048576
+
+/**
+ * @def WORD_SIZE 8
+ * @brief A Macro that sets the amount of characters which are scanned at once.
+ */
+#define WORD_SIZE 8
+
+/**
+ * @def LOW_BITS 0x0101010101010101ULL
+ * @brief A Macro that sets a word where the lowest bit of every character is set.
+ */
+#define LOW_BITS 0x0101010101010101ULL
+
+/**
+ * @def HIGH_BITS 0x8080808080808080ULL
+ * @brief A Macro that sets a word where the highest bit of every character is set.
+ */
+#define HIGH_BITS 0x8080808080808080ULL
+
+/**
+ * @def MAX_MANTISSA_DIGITS 19
+ * @brief A Macro that sets the largest amount of significant digits which always fit in 64 bits.
+ */
+#define MAX_MANTISSA_DIGITS 19
+
+/**
+ * @def MAX_EXACT_MANTISSA 9007199254740992ULL
+ * @brief A Macro that sets the largest mantissa (2^53) which a double holds exactly.
+ */
+#define MAX_EXACT_MANTISSA 9007199254740992ULL
+
+/**
+ * @def MAX_EXACT_EXPONENT 22
+ * @brief A Macro that sets the largest power of 10 which a double holds exactly.
+ */
+#define MAX_EXACT_EXPONENT 22
+
+/**
+ * @def MAX_EXPONENT_DIGITS 4
+ * @brief A Macro that sets the largest amount of exponent digits read by the fast conversion.
+ */
+#define MAX_EXPONENT_DIGITS 4
+
+/**
+ * @def CONVERSION_BUFFER_SIZE 128
+ * @brief A Macro that sets the size of the buffer which holds a coordinate for strtod.
+ */
+#define CONVERSION_BUFFER_SIZE 128
+
+/**
+ * @def DECIMAL_BASE 10
+ * @brief A Macro that sets the base of the numbers in the input.
+ */
+#define DECIMAL_BASE 10
+
+
+/*-----=  Static Definitions  =-----*/
+
+
+/**
+ * @brief The powers of 10 which a double holds exactly.
+ */
+static const CordType EXACT_POWERS[MAX_EXACT_EXPONENT + 1] =
+{
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+
+/*-----=  Shape Parser Helpers  =-----*/
+
+
+/**
+ * @brief Check if the given character is a white space, the same way strtod checks it in the
+ *        default locale.
+ * @param character The character to check.
+ * @return true if the character is a white space, false otherwise.
+ */
+static inline bool isSpace(const char character)
+{
+    return character == ' ' || (character >= '\t' && character <= '\r');
+}
+
+/**
+ * @brief Check if the given character is a decimal digit.
+ * @param character The character to check.
+ * @return true if the character is a digit, false otherwise.
+ */
+static inline bool isDigit(const char character)
+{
+    return character >= '0' && character <= '9';
+}
+
+/**
+ * @brief Read a coordinate using strtod, for the numbers which the fast conversion does not
+ *        handle (e.g. hexadecimal numbers, infinity or very long numbers).
+ *        The coordinate is copied to a buffer on the stack, so strtod never reads past it.
+ * @param begin The first character of the coordinate.
+ * @param end The character after the last character of the coordinate.
+ * @param value The value of the coordinate.
+ * @return true if the characters start with a number within the range of CordType,
+ *         false otherwise.
+ */
+static bool convertCoordinate(const char *begin, const char *end, CordType& value)
+{
+    size_t length = (size_t) (end - begin);
+    char buffer[CONVERSION_BUFFER_SIZE];
+    std::string longCoordinate;
+    const char *text = buffer;
+    if (length < CONVERSION_BUFFER_SIZE)
+    {
+        memcpy(buffer, begin, length);
+        buffer[length] = '\0';
+    }
+    else
+    {
+        // A coordinate this long is very rare, so we allow the allocation here.
+        longCoordinate.assign(begin, length);
+        text = longCoordinate.c_str();
+    }
+
+    char *converted;
+    errno = 0;
+    value = strtod(text, &converted);
+
+    // Like std::stod, a coordinate without a number or out of range is an error.
+    return converted != text && errno != ERANGE;
+}
+
+
+/**
+ * @brief Move the given position in the input forward to the start of a line. A position which
+ *        is already at the start of a line is not moved.
+ * @param input The span of the lines to parse.
+ * @param position A position in the span.
+ * @return The position of the first line which starts at the given position or after it, or the
+ *         length of the span if there is no such line.
+ */
+static size_t alignToLine(const LineSpan& input, size_t const position)
+{
+    if (position == 0 || position >= input.length || input.begin[position - 1] == NEW_LINE)
+    {
+        return std::min(position, input.length);
+    }
+    const char *lineEnd = (const char *) memchr(input.begin + position, NEW_LINE,
+                                                input.length - position);
+    return lineEnd != nullptr ? (size_t) (lineEnd - input.begin) + 1 : input.length;
+}
+
+
+/*-----=  Shape Parser Methods  =-----*/
+
+
+/**
+ * @brief Find the first coordinates separator (a tab) in the given characters.
+ *        The characters are scanned a word (8 characters) at a time.
+ * @param begin The first character to scan.
+ * @param length The amount of characters to scan.
+ * @return The index of the separator, or the given length if there is no separator.
+ */
+size_t findSeparator(const char *begin, size_t const length)
+{
+    const uint64_t separators = LOW_BITS * (unsigned char) COORDINATES_SEPARATOR;
+    size_t index = 0;
+    for (; index + WORD_SIZE <= length; index += WORD_SIZE)
+    {
+        uint64_t word;
+        memcpy(&word, begin + index, WORD_SIZE);
+
+        // Every separator becomes a zero character, and a zero character sets it's highest bit.
+        word ^= separators;
+        if (((word - LOW_BITS) & ~word & HIGH_BITS) != 0)
+        {
+            break;
+        }
+    }
+
+    // Find the exact separator in the last word scanned, or in the remaining characters.
+    for (; index < length; ++index)
+    {
+        if (begin[index] == COORDINATES_SEPARATOR)
+        {
+            return index;
+        }
+    }
+    return length;
+}
+
+/**
+ * @brief Read a coordinate from the given characters, the same way std::stod reads it: leading
+ *        white spaces are skipped, and the longest prefix which forms a number is read.
+ *        Simple decimal numbers are converted directly with a single correctly rounded operation,
+ *        and any other number is converted by the C library.
+ * @param begin The first character of the coordinate.
+ * @param end The character after the last character of the coordinate.
+ * @param value The value of the coordinate.
+ * @return true if the characters start with a number within the range of CordType,
+ *         false otherwise.
+ */
+bool parseCoordinate(const char *begin, const char *end, CordType& value)
+{
+    const char *current = begin;
+    while (current != end && isSpace(*current))
+    {
+        ++current;
+    }
+
+    bool negative = false;
+    if (current != end && (*current == '-' || *current == '+'))
+    {
+        negative = *current == '-';
+        ++current;
+    }
+
+    // Hexadecimal numbers are left to strtod.
+    if (current + 1 < end && current[0] == '0' && (current[1] == 'x' || current[1] == 'X'))
+    {
+        return convertCoordinate(begin, end, value);
+    }
+
+    // Read the digits into an integer mantissa, ignoring the leading zeros.
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int significantDigits = 0;
+    int exponent = 0;
+    for (; current != end && isDigit(*current); ++current, ++digits)
+    {
+        if (mantissa != 0 || *current != '0')
+        {
+            mantissa = mantissa * DECIMAL_BASE + (uint64_t) (*current - '0');
+            ++significantDigits;
+        }
+    }
+    if (current != end && *current == '.')
+    {
+        for (++current; current != end && isDigit(*current); ++current, ++digits)
+        {
+            if (mantissa != 0 || *current != '0')
+            {
+                mantissa = mantissa * DECIMAL_BASE + (uint64_t) (*current - '0');
+                ++significantDigits;
+            }
+            --exponent;
+        }
+    }
+    if (digits == 0 || significantDigits > MAX_MANTISSA_DIGITS)
+    {
+        // No digits (e.g. infinity or an invalid coordinate), or too many of them.
+        return convertCoordinate(begin, end, value);
+    }
+
+    // The exponent is read only if it has digits, otherwise it is not part of the number.
+    if (current != end && (*current == 'e' || *current == 'E'))
+    {
+        const char *exponentBegin = current + 1;
+        bool negativeExponent = false;
+        if (exponentBegin != end && (*exponentBegin == '-' || *exponentBegin == '+'))
+        {
+            negativeExponent = *exponentBegin == '-';
+            ++exponentBegin;
+        }
+        if (exponentBegin != end && isDigit(*exponentBegin))
+        {
+            int exponentValue = 0;
+            int exponentDigits = 0;
+            for (current = exponentBegin; current != end && isDigit(*current); ++current)
+            {
+                if (++exponentDigits > MAX_EXPONENT_DIGITS)
+                {
+                    return convertCoordinate(begin, end, value);
+                }
+                exponentValue = exponentValue * DECIMAL_BASE + (*current - '0');
+            }
+            exponent += negativeExponent ? -exponentValue : exponentValue;
+        }
+    }
+
+    if (mantissa == 0)
+    {
+        value = negative ? -0.0 : 0.0;
+        return true;
+    }
+    if (mantissa > MAX_EXACT_MANTISSA || exponent < -MAX_EXACT_EXPONENT ||
+        exponent > MAX_EXACT_EXPONENT)
+    {
+        return convertCoordinate(begin, end, value);
+    }
+
+    // Both the mantissa and the power of 10 are exact, so a single operation rounds correctly.
+    value = (CordType) mantissa;
+    value = exponent < 0 ? value / EXACT_POWERS[-exponent] : value * EXACT_POWERS[exponent];
+    if (negative)
+    {
+        value = -value;
+    }
+    return true;
+}
+
+/**
+ * @brief Read the coordinates from the given line into the given Points Vector. The first token
+ *        of the line is the Shape's type, and every 2 tokens after it form a Point.
+ *        A Shape has at most MAX_SHAPE_VERTICES Vertices, so a line with more Points does not
+ *        hold a valid Shape of any type.
+ * @param currentLine The span of the line to parse.
+ * @param points The Points Vector which stores the Points for the current Shape.
+ * @return true if all the coordinates were read, false otherwise.
+ */
+bool parseCoordinates(LineSpan currentLine, PointVector& points)
+{
+    const char *current = currentLine.begin;
+    const char *end = currentLine.begin + currentLine.length;
+
+    // Remove the redundant Token of the shape's type.
+    size_t currentIndex = findSeparator(current, currentLine.length);
+    bool moreTokens = currentIndex != currentLine.length;
+    current += moreTokens ? currentIndex + 1 : currentIndex;
+
+    // Start iterating over the shape's coordinates.
+    // The last coordinate is not skipped, so a Shape with an odd amount of coordinates reads
+    // it's last coordinate as both X and Y.
+    while (moreTokens)
+    {
+        CordType values[2];
+        for (CordType& value : values)
+        {
+            currentIndex = findSeparator(current, (size_t) (end - current));
+            const char *tokenEnd = current + currentIndex;
+            if (!parseCoordinate(current, tokenEnd, value))
+            {
+                return false;
+            }
+            moreTokens = tokenEnd != end;
+            if (moreTokens)
+            {
+                current = tokenEnd + 1;
+            }
+        }
+
+        // Create the current Point and add it to the Points Vector.
+        if (points.full())
+        {
+            return false;
+        }
+        points.push_back(Point(values[0], values[1]));
+    }
+    return true;
+}
+
+/**
+ * @brief Read a single Point from the given line of a Points file, where the X and Y coordinates
+ *        of the Point are separated by a tab.
+ * @param currentLine The span of the line to parse.
+ * @param x The X coordinate of the Point.
+ * @param y The Y coordinate of the Point.
+ * @return true if the line holds exactly 2 coordinates, false otherwise.
+ */
+bool parsePoint(const LineSpan& currentLine, CordType& x, CordType& y)
+{
+    const char *begin = currentLine.begin;
+    const char *end = currentLine.begin + currentLine.length;
+    size_t separator = findSeparator(begin, currentLine.length);
+    if (separator == currentLine.length || !parseCoordinate(begin, begin + separator, x))
+    {
+        return false;
+    }
+    begin += separator + 1;
+    return findSeparator(begin, (size_t) (end - begin)) == (size_t) (end - begin) &&
+           parseCoordinate(begin, end, y);
+}
+
+/**
+ * @brief Create the Shape which is described in the given line, and validate it.
+ * @param currentLine The span of the line to parse. The line must not be empty.
+ * @param shape A pointer to the created Shape in case of success, NULL Pointer otherwise.
+ * @param shapeType The type of the Shape in the line.
+ * @param arena The arena to create the Shape in, or Null Pointer for the heap.
+ * @return PARSE_SUCCESS if the line holds a valid Shape, or the reason it does not.
+ */
+ParseStatus parseShape(const LineSpan& currentLine, ShapeP& shape, ShapeType& shapeType,
+                       ShapeArena *arena)
+{
+    shape = nullptr;
+
+    // Determine the shape's type.
+    shapeType = getShapeType(currentLine.begin[SHAPE_TYPE_INDEX]);
+    if (shapeType == INVALID_TYPE)
+    {
+        return PARSE_INVALID_TYPE;
+    }
+
+    // Parse the current line into coordinates and create the proper Shape object.
+    PointVector points;
+    if (!parseCoordinates(currentLine, points))
+    {
+        return PARSE_ILLEGAL_SHAPE;
+    }
+    shape = shapeFactory(shapeType, points, arena);
+    if (shape == nullptr || !shape -> validateShape())
+    {
+        destroyShape(shape, arena);
+        shape = nullptr;
+        return PARSE_ILLEGAL_SHAPE;
+    }
+    return PARSE_SUCCESS;
+}
+
+/**
+ * @brief Create the Shapes which are described in the lines of the given span, in their order.
+ *        Empty lines are ignored, and the parsing stops at the first line which does not hold a
+ *        valid Shape.
+ * @param input The span of the lines to parse.
+ * @param shapes The Shapes Vector which the created Shapes are added to.
+ * @param shapeType The type of the Shape in the line which stopped the parsing.
+ * @param arena The arena to create the Shapes in, or Null Pointer for the heap.
+ * @return PARSE_SUCCESS if all the lines hold valid Shapes, or the reason the parsing stopped.
+ */
+ParseStatus parseShapes(const LineSpan& input, ShapeVector& shapes, ShapeType& shapeType,
+                        ShapeArena *arena)
+{
+    const char *current = input.begin;
+    const char *end = input.begin + input.length;
+    while (current != end)
+    {
+        // Like std::getline, the last line counts even if it does not end with a new line.
+        const char *lineEnd = (const char *) memchr(current, NEW_LINE, (size_t) (end - current));
+        if (lineEnd == nullptr)
+        {
+            lineEnd = end;
+        }
+        LineSpan currentLine = {current, (size_t) (lineEnd - current)};
+        current = lineEnd != end ? lineEnd + 1 : end;
+
+        // We ignore empty lines in the input.
+        if (currentLine.length == EMPTY_LINE_LENGTH)
+        {
+            continue;
+        }
+
+        ShapeP currentShape = nullptr;
+        ParseStatus status = parseShape(currentLine, currentShape, shapeType, arena);
+        if (status != PARSE_SUCCESS)
+        {
+            return status;
+        }
+        shapes.push_back(currentShape);
+    }
+    return PARSE_SUCCESS;
+}
+
+/**
+ * @brief Create the Shapes which are described in the lines of the given span using several
+ *        worker threads. The span is split to ranges of whole lines, every range is parsed into
+ *        it's own Shapes Vector, and the Vectors are joined in the order of the ranges.
+ *        The result is the same as the result of parseShapes(): the Shapes are in their order in
+ *        the input, and the reported error is the error in the first invalid line.
+ *        Small inputs are parsed by fewer threads, so every thread has enough lines to parse.
+ *        Every thread creates it's Shapes in it's own arena, and the arenas are then moved to
+ *        the given arena.
+ * @param input The span of the lines to parse.
+ * @param threads The largest amount of worker threads to use.
+ * @param shapes The Shapes Vector which the created Shapes are added to.
+ * @param shapeType The type of the Shape in the line which stopped the parsing.
+ * @param arena The arena to create the Shapes in, or Null Pointer for the heap.
+ * @return PARSE_SUCCESS if all the lines hold valid Shapes, or the reason the parsing stopped.
+ */
+ParseStatus parseShapesParallel(const LineSpan& input, ThreadCount threads, ShapeVector& shapes,
+                                ShapeType& shapeType, ShapeArena *arena)
+{
+    threads = (ThreadCount) std::min((size_t) threads, input.length / PARSE_RANGE_MIN_SIZE);
+    if (threads <= 1)
+    {
+        return parseShapes(input, shapes, shapeType, arena);
+    }
+
+    // Every thread parses the lines which start in it's part of the input. A line which crosses
+    // the border between two parts belongs to the part where it starts.
+    std::vector<ShapeVector> rangeShapes(threads);
+    std::vector<ParseStatus> rangeStatus(threads, PARSE_SUCCESS);
+    std::vector<ShapeType> rangeTypes(threads, INVALID_TYPE);
+    std::vector<ShapeArena> rangeArenas(arena != nullptr ? threads : 0);
+    parallelFor(input.length, threads, [&](size_t begin, size_t end, ThreadCount thread)
+    {
+        size_t first = alignToLine(input, begin);
+        size_t last = alignToLine(input, end);
+        LineSpan range = {input.begin + first, last - first};
+        ShapeArena *rangeArena = arena != nullptr ? &rangeArenas[thread] : nullptr;
+        rangeStatus[thread] = parseShapes(range, rangeShapes[thread], rangeTypes[thread],
+                                          rangeArena);
+    });
+    for (auto i = rangeArenas.begin(); i != rangeArenas.end(); i++)
+    {
+        arena -> absorb(*i);
+    }
+
+    // Join the ranges up to the first range which stopped with an error. The Shapes of the later
+    // ranges come after the invalid line, so they are not part of the result.
+    ParseStatus status = PARSE_SUCCESS;
+    for (ThreadCount thread = 0; thread < threads; ++thread)
+    {
+        ShapeVector& currentShapes = rangeShapes[thread];
+        if (status != PARSE_SUCCESS)
+        {
+            for (auto i = currentShapes.begin(); i != currentShapes.end(); i++)
+            {
+                destroyShape(*i, arena);
+            }
+            continue;
+        }
+        shapes.insert(shapes.end(), currentShapes.begin(), currentShapes.end());
+        status = rangeStatus[thread];
+        shapeType = rangeTypes[thread];
+    }
+    return status;
+}
@@ -0,0 +1,139 @@
+/**
+ * @file ShapeParser.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header File for the Shape Parser, which creates Shapes from the lines of the input.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Shape Parser, which creates Shapes from the lines of the input.
+ * A line holds the type of the Shape followed by it's coordinates, separated by tabs.
+ * The Parser scans a line once, without copying it and without allocating memory, and reports
+ * errors using status codes instead of exceptions.
+ * A large input is split to ranges of whole lines which are parsed together by several threads,
+ * and the Shapes of the ranges are joined in their order in the input.
+ */
+
+
+#ifndef SHAPEPARSER_H
+#define SHAPEPARSER_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include "ShapeFactory.h"
+#include "InputReader.h"
+#include "Parallel.h"
+
+
+/*-----=  Enums  =-----*/
+
+
+/**
+ * @brief An Enum for the results of parsing a line of the input.
+ */
+enum ParseStatus
+{
+    PARSE_SUCCESS,        // The line holds a valid Shape.
+    PARSE_INVALID_TYPE,   // The line starts with an unknown Shape type.
+    PARSE_ILLEGAL_SHAPE,  // The Shape's coordinates can not be read, or they form an illegal Shape.
+    PARSE_INVALID_FILE    // The layout of a binary input is damaged.
+};
+
+
+/*-----=  Shape Parser Methods  =-----*/
+
+
+/**
+ * @brief Find the first coordinates separator (a tab) in the given characters.
+ *        The characters are scanned a word (8 characters) at a time.
+ * @param begin The first character to scan.
+ * @param length The amount of characters to scan.
+ * @return The index of the separator, or the given length if there is no separator.
+ */
+size_t findSeparator(const char *begin, size_t const length);
+
+/**
+ * @brief Read a coordinate from the given characters, the same way std::stod reads it: leading
+ *        white spaces are skipped, and the longest prefix which forms a number is read.
+ *        Simple decimal numbers are converted directly with a single correctly rounded operation,
+ *        and any other number is converted by the C library.
+ * @param begin The first character of the coordinate.
+ * @param end The character after the last character of the coordinate.
+ * @param value The value of the coordinate.
+ * @return true if the characters start with a number within the range of CordType,
+ *         false otherwise.
+ */
+bool parseCoordinate(const char *begin, const char *end, CordType& value);
+
+/**
+ * @brief Read the coordinates from the given line into the given Points Vector. The first token
+ *        of the line is the Shape's type, and every 2 tokens after it form a Point.
+ *        A Shape has at most MAX_SHAPE_VERTICES Vertices, so a line with more Points does not
+ *        hold a valid Shape of any type.
+ * @param currentLine The span of the line to parse.
+ * @param points The Points Vector which stores the Points for the current Shape.
+ * @return true if all the coordinates were read, false otherwise.
+ */
+bool parseCoordinates(LineSpan currentLine, PointVector& points);
+
+/**
+ * @brief Read a single Point from the given line of a Points file, where the X and Y coordinates
+ *        of the Point are separated by a tab.
+ * @param currentLine The span of the line to parse.
+ * @param x The X coordinate of the Point.
+ * @param y The Y coordinate of the Point.
+ * @return true if the line holds exactly 2 coordinates, false otherwise.
+ */
+bool parsePoint(const LineSpan& currentLine, CordType& x, CordType& y);
+
+/**
+ * @brief Create the Shape which is described in the given line, and validate it.
+ * @param currentLine The span of the line to parse. The line must not be empty.
+ * @param shape A pointer to the created Shape in case of success, NULL Pointer otherwise.
+ * @param shapeType The type of the Shape in the line.
+ * @param arena The arena to create the Shape in, or Null Pointer for the heap.
+ * @return PARSE_SUCCESS if the line holds a valid Shape, or the reason it does not.
+ */
+ParseStatus parseShape(const LineSpan& currentLine, ShapeP& shape, ShapeType& shapeType,
+                       ShapeArena *arena);
+
+/**
+ * @brief Create the Shapes which are described in the lines of the given span, in their order.
+ *        Empty lines are ignored, and the parsing stops at the first line which does not hold a
+ *        valid Shape.
+ * @param input The span of the lines to parse.
+ * @param shapes The Shapes Vector which the created Shapes are added to.
+ * @param shapeType The type of the Shape in the line which stopped the parsing.
+ * @param arena The arena to create the Shapes in, or Null Pointer for the heap.
+ * @return PARSE_SUCCESS if all the lines hold valid Shapes, or the reason the parsing stopped.
+ */
+ParseStatus parseShapes(const LineSpan& input, ShapeVector& shapes, ShapeType& shapeType,
+                        ShapeArena *arena);
+
+/**
+ * @brief Create the Shapes which are described in the lines of the given span using several
+ *        worker threads. The span is split to ranges of whole lines, every range is parsed into
+ *        it's own Shapes Vector, and the Vectors are joined in the order of the ranges.
+ *        The result is the same as the result of parseShapes(): the Shapes are in their order in
+ *        the input, and the reported error is the error in the first invalid line.
+ *        Small inputs are parsed by fewer threads, so every thread has enough lines to parse.
+ *        Every thread creates it's Shapes in it's own arena, and the arenas are then moved to
+ *        the given arena.
+ * @param input The span of the lines to parse.
+ * @param threads The largest amount of worker threads to use.
+ * @param shapes The Shapes Vector which the created Shapes are added to.
+ * @param shapeType The type of the Shape in the line which stopped the parsing.
+ * @param arena The arena to create the Shapes in, or Null Pointer for the heap.
+ * @return PARSE_SUCCESS if all the lines hold valid Shapes, or the reason the parsing stopped.
+ */
+ParseStatus parseShapesParallel(const LineSpan& input, ThreadCount threads, ShapeVector& shapes,
+                                ShapeType& shapeType, ShapeArena *arena);
+
+
+#endif
@@ -0,0 +1,714 @@
+/**
+ * @file ShapeService.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A File for the ShapeService Class implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the ShapeService Class implementation.
+ * Define the ShapeService Class, it's methods and fields.
+ * The Shapes are kept in a ShapeStore next to the sorted indices they were added with, so the
+ * index of a Shape never changes even when it's place in the store does. A removed Shape is only
+ * marked, and every query skips it. The grid is built again with a fitting cell size every time
+ * the amount of Shapes doubles or too many of them are oversized, like in the StreamChecker, and
+ * every time half of the stored Shapes were removed, and each build drops the removed Shapes.
+ * The clients are served by a single thread which waits on all their sockets at once, so the
+ * commands are run one at a time in the order they arrive.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include "ShapeService.h"
+#include "SweepLine.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def FIRST_CAPACITY 1024
+ * @brief A Macro that sets the amount of Shapes which the first grid is built for.
+ */
+#define FIRST_CAPACITY 1024
+
+/**
+ * @def CAPACITY_GROWTH 2
+ * @brief A Macro that sets the factor which the amount of Shapes grows by between two builds.
+ */
+#define CAPACITY_GROWTH 2
+
+/**
+ * @def OVERSIZED_GROWTH 2
+ * @brief A Macro that sets the factor which the amount of oversized Shapes in the grid may grow by
+ *        before the grid is built again.
+ */
+#define OVERSIZED_GROWTH 2
+
+/**
+ * @def FIRST_SHAPE_NUMBER 1
+ * @brief A Macro that sets the number of the first Shape, so the Shapes are numbered in the
+ *        order they were added starting from 1.
+ */
+#define FIRST_SHAPE_NUMBER 1
+
+/**
+ * @def MAX_NUMBER_DIGITS 18
+ * @brief A Macro that sets the largest amount of digits in the number of a Shape.
+ */
+#define MAX_NUMBER_DIGITS 18
+
+/**
+ * @def DECIMAL_BASE 10
+ * @brief A Macro that sets the base of the numbers of the Shapes.
+ */
+#define DECIMAL_BASE 10
+
+/**
+ * @def DECIMAL_POINT_PRECISION 2
+ * @brief A Macro that sets the number of digits after the decimal point in an answered area.
+ */
+#define DECIMAL_POINT_PRECISION 2
+
+/**
+ * @def NUMBER_SEPARATOR '\t'
+ * @brief A Macro that sets the separator between the numbers in an answer.
+ */
+#define NUMBER_SEPARATOR '\t'
+
+/**
+ * @def LINE_END '\n'
+ * @brief A Macro that sets the character which ends a command and an answer.
+ */
+#define LINE_END '\n'
+
+/**
+ * @def CARRIAGE_RETURN '\r'
+ * @brief A Macro that sets the character which may appear before the end of a command.
+ */
+#define CARRIAGE_RETURN '\r'
+
+/**
+ * @def SERVICE_BACKLOG 16
+ * @brief A Macro that sets the amount of clients which may wait for the service to accept them.
+ */
+#define SERVICE_BACKLOG 16
+
+/**
+ * @def SERVICE_READ_SIZE 65536
+ * @brief A Macro that sets the largest amount of bytes which are read from a client at once.
+ */
+#define SERVICE_READ_SIZE 65536
+
+/**
+ * @def MAX_COMMAND_LENGTH 65536
+ * @brief A Macro that sets the largest length of a command, so a client which never ends a line
+ *        can not fill the memory of the service.
+ */
+#define MAX_COMMAND_LENGTH 65536
+
+/**
+ * @def ADD_COMMAND "add"
+ * @brief A Macro that sets the command which adds a Shape.
+ */
+#define ADD_COMMAND "add"
+
+/**
+ * @def REMOVE_COMMAND "remove"
+ * @brief A Macro that sets the command which removes a Shape.
+ */
+#define REMOVE_COMMAND "remove"
+
+/**
+ * @def QUERY_OVERLAP_COMMAND "query-overlap"
+ * @brief A Macro that sets the command which finds the Shapes which intersect a Shape.
+ */
+#define QUERY_OVERLAP_COMMAND "query-overlap"
+
+/**
+ * @def TOTAL_AREA_COMMAND "total-area"
+ * @brief A Macro that sets the command which calculates the total area of the Shapes.
+ */
+#define TOTAL_AREA_COMMAND "total-area"
+
+/**
+ * @def SHUTDOWN_COMMAND "shutdown"
+ * @brief A Macro that sets the command which stops the service.
+ */
+#define SHUTDOWN_COMMAND "shutdown"
+
+/**
+ * @def DONE_RESPONSE "OK"
+ * @brief A Macro that sets the answer of a command which has no result.
+ */
+#define DONE_RESPONSE "OK"
+
+/**
+ * @def ILLEGAL_SHAPE_MESSAGE "ERROR: Illegal "
+ * @brief A Macro that sets the error answer for invalid Shape coordinates.
+ */
+#define ILLEGAL_SHAPE_MESSAGE "ERROR: Illegal "
+
+/**
+ * @def INVALID_SHAPE_MESSAGE "ERROR: Invalid Shape Type."
+ * @brief A Macro that sets the error answer for invalid Shape type.
+ */
+#define INVALID_SHAPE_MESSAGE "ERROR: Invalid Shape Type."
+
+/**
+ * @def UNKNOWN_SHAPE_MESSAGE "ERROR: Unknown Shape."
+ * @brief A Macro that sets the error answer for a number which is not of a live Shape.
+ */
+#define UNKNOWN_SHAPE_MESSAGE "ERROR: Unknown Shape."
+
+/**
+ * @def UNKNOWN_COMMAND_MESSAGE "ERROR: Unknown command."
+ * @brief A Macro that sets the error answer for an unknown command.
+ */
+#define UNKNOWN_COMMAND_MESSAGE "ERROR: Unknown command."
+
+/**
+ * @def LONG_COMMAND_MESSAGE "ERROR: Command too long."
+ * @brief A Macro that sets the error answer for a command which is longer than the largest length.
+ */
+#define LONG_COMMAND_MESSAGE "ERROR: Command too long."
+
+
+/*-----=  Service Helpers  =-----*/
+
+
+/**
+ * @brief Add the number of the Shape in the given index to the end of the given answer.
+ * @param response The answer.
+ * @param index The index of the Shape.
+ */
+static void appendNumber(std::string& response, ShapeIndex const index)
+{
+    response += std::to_string(index + FIRST_SHAPE_NUMBER);
+}
+
+/**
+ * @brief Add the numbers of the Shapes in the given indices to the end of the given answer,
+ *        where every number but the first is preceded by a separator.
+ * @param response The answer.
+ * @param overlaps The indices of the Shapes.
+ */
+static void appendNumbers(std::string& response, const std::vector<ShapeIndex>& overlaps)
+{
+    for (auto i = overlaps.begin(); i != overlaps.end(); i++)
+    {
+        if (i != overlaps.begin())
+        {
+            response.push_back(NUMBER_SEPARATOR);
+        }
+        appendNumber(response, *i);
+    }
+}
+
+/**
+ * @brief Read the number of a Shape from the given argument of a command.
+ * @param argument The argument, which holds only decimal digits.
+ * @param index The index of the Shape with this number.
+ * @return true if the argument is a valid number, false otherwise.
+ */
+static bool parseNumber(const LineSpan& argument, ShapeIndex& index)
+{
+    if (argument.length == 0 || argument.length > MAX_NUMBER_DIGITS)
+    {
+        return false;
+    }
+    ShapeIndex number = 0;
+    for (size_t i = 0; i < argument.length; i++)
+    {
+        if (argument.begin[i] < '0' || argument.begin[i] > '9')
+        {
+            return false;
+        }
+        number = number * DECIMAL_BASE + (ShapeIndex) (argument.begin[i] - '0');
+    }
+    if (number < FIRST_SHAPE_NUMBER)
+    {
+        return false;
+    }
+    index = number - FIRST_SHAPE_NUMBER;
+    return true;
+}
+
+/**
+ * @brief Send the whole given answer to the given client.
+ * @param client The socket of the client.
+ * @param response The answer to send.
+ * @return true if the answer was sent, false if the client disconnected.
+ */
+static bool sendAll(int const client, const std::string& response)
+{
+    size_t sent = 0;
+    while (sent < response.size())
+    {
+        // A client which disconnected must not stop the service with a signal.
+        ssize_t count = send(client, response.data() + sent, response.size() - sent,
+                             MSG_NOSIGNAL);
+        if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (count <= 0)
+        {
+            return false;
+        }
+        sent += (size_t) count;
+    }
+    return true;
+}
+
+
+/*-----=  ShapeService Constructors  =-----*/
+
+
+/**
+ * @brief A Constructor for the ShapeService, which creates a service with no Shapes.
+ */
+ShapeService::ShapeService() : _nextIndex(0), _removedCount(0), _capacity(0), _oversizedLimit(0),
+                               _chunk(SERVICE_READ_SIZE)
+{
+
+}
+
+
+/*-----=  ShapeService Methods  =-----*/
+
+
+/**
+ * @brief Drop the removed Shapes from the store, and build the grid again from the live
+ *        Shapes with a cell size which fits them.
+ */
+void ShapeService::_rebuild()
+{
+    if (_removedCount > 0)
+    {
+        _shapes.compact(_live);
+        ShapeIndex kept = 0;
+        for (ShapeIndex i = 0; i < _indices.size(); i++)
+        {
+            if (_live[i])
+            {
+                _indices[kept++] = _indices[i];
+            }
+        }
+        _indices.resize(kept);
+        _live.assign(kept, true);
+        _removedCount = 0;
+    }
+    if (_shapes.size() == 0)
+    {
+        // The next added Shape builds the first grid again.
+        _grid.reset();
+        _capacity = 0;
+        return;
+    }
+
+    _capacity = std::max((ShapeIndex) FIRST_CAPACITY, _shapes.size() * CAPACITY_GROWTH);
+    _grid.reset(new SpatialGrid(SpatialGrid::chooseCellSize(_shapes), _capacity));
+    _grid -> build(_shapes);
+
+    // Every new oversized Shape is checked by every later query, so allowing about the square root
+    // of the amount of Shapes between two builds balances the queries against the builds.
+    _oversizedLimit = _grid -> getOversizedCount() * OVERSIZED_GROWTH +
+                      (size_t) std::sqrt((double) _shapes.size());
+}
+
+/**
+ * @brief Find the live Shapes which intersect the given Shape.
+ * @param shape The Shape to check.
+ * @param overlaps The Vector which the indices of the intersecting Shapes are added to, in
+ *        their order.
+ */
+void ShapeService::_findOverlaps(const ShapeView& shape, std::vector<ShapeIndex>& overlaps)
+{
+    if (_grid == nullptr)
+    {
+        return;
+    }
+    _candidates.clear();
+    _grid -> query(shape.getBoundingBox(), _candidates);
+    std::sort(_candidates.begin(), _candidates.end());
+    for (auto i = _candidates.begin(); i != _candidates.end(); i++)
+    {
+        if (_live[*i] && shapesIntersect(shape, _shapes.getShape(*i)))
+        {
+            overlaps.push_back(_indices[*i]);
+        }
+    }
+}
+
+/**
+ * @brief Add the given Shape to the live Shapes, after finding the live Shapes which
+ *        intersect it.
+ * @param shape The Shape to add.
+ * @param overlaps The Vector which the indices of the intersecting Shapes are added to, in
+ *        their order.
+ * @return The index of the added Shape, which is it's position in the order the Shapes were
+ *         added.
+ */
+ShapeIndex ShapeService::addShape(const Shape& shape, std::vector<ShapeIndex>& overlaps)
+{
+    _shapes.append(shape);
+    _live.push_back(true);
+    _indices.push_back(_nextIndex++);
+    ShapeIndex last = _shapes.size() - 1;
+    ShapeView view = _shapes.getShape(last);
+    _findOverlaps(view, overlaps);
+
+    // Building the grid on every doubling costs a constant amount of work per Shape.
+    if (_shapes.size() > _capacity || _grid -> getOversizedCount() > _oversizedLimit)
+    {
+        _rebuild();
+    }
+    else
+    {
+        _grid -> insert(last, view.getBoundingBox());
+    }
+    return _indices.back();
+}
+
+/**
+ * @brief Remove the Shape in the given index from the live Shapes. The removed Shapes are
+ *        dropped from the memory when the grid is built again.
+ * @param index The index of the Shape, which is it's position in the order the Shapes were
+ *        added.
+ * @return true if the Shape was live and is removed, false otherwise.
+ */
+bool ShapeService::removeShape(ShapeIndex const index)
+{
+    auto found = std::lower_bound(_indices.begin(), _indices.end(), index);
+    if (found == _indices.end() || *found != index || !_live[found - _indices.begin()])
+    {
+        return false;
+    }
+    _live[found - _indices.begin()] = false;
+    _removedCount++;
+
+    // Dropping the removed Shapes once they are half of the store costs a constant amount of
+    // work per removed Shape.
+    if (_removedCount * CAPACITY_GROWTH > _shapes.size())
+    {
+        _rebuild();
+    }
+    return true;
+}
+
+/**
+ * @brief Calculate the total area of all the live Shapes, adding the areas in the order the
+ *        Shapes were added.
+ * @return The total area of the live Shapes.
+ */
+CordType ShapeService::getTotalArea() const
+{
+    CordType result = EMPTY_SHAPE_SIZE;
+    for (ShapeIndex i = 0; i < _shapes.size(); i++)
+    {
+        if (_live[i])
+        {
+            result += _shapes.getArea(i);
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Parse the Shape in the given line, and write an error to the answer if it is not a
+ *        valid Shape.
+ * @param line The line of the Shape.
+ * @param shape The parsed Shape, which is created in the arena of the service.
+ * @param response The string to write an error to.
+ * @return true if the line holds a valid Shape, false otherwise.
+ */
+bool ShapeService::_parseShape(const LineSpan& line, ShapeP& shape, std::string& response)
+{
+    ShapeType shapeType = INVALID_TYPE;
+    ParseStatus status = parseShape(line, shape, shapeType, &_arena);
+    if (status == PARSE_SUCCESS)
+    {
+        return true;
+    }
+    if (status == PARSE_ILLEGAL_SHAPE)
+    {
+        response = ILLEGAL_SHAPE_MESSAGE + getShapeName(shapeType);
+    }
+    else
+    {
+        response = INVALID_SHAPE_MESSAGE;
+    }
+    return false;
+}
+
+/**
+ * @brief Run the given command and write it's answer, without the end of the line.
+ * @param command The line of the command.
+ * @param response The string to write the answer to.
+ * @return true if the service should keep running, false if the command stops it.
+ */
+bool ShapeService::handleCommand(const LineSpan& command, std::string& response)
+{
+    // The name of the command ends at the first space or tab, and the rest is it's argument.
+    size_t nameLength = 0;
+    while (nameLength < command.length && command.begin[nameLength] != ' ' &&
+           command.begin[nameLength] != '\t')
+    {
+        nameLength++;
+    }
+    std::string name(command.begin, nameLength);
+    LineSpan argument = {command.begin + nameLength, 0};
+    if (nameLength < command.length)
+    {
+        argument.begin++;
+        argument.length = command.length - nameLength - 1;
+    }
+
+    response.clear();
+    std::vector<ShapeIndex> overlaps;
+    ShapeP shape = nullptr;
+    if (name == ADD_COMMAND)
+    {
+        if (_parseShape(argument, shape, response))
+        {
+            appendNumber(response, addShape(*shape, overlaps));
+            if (!overlaps.empty())
+            {
+                response.push_back(NUMBER_SEPARATOR);
+                appendNumbers(response, overlaps);
+            }
+        }
+    }
+    else if (name == QUERY_OVERLAP_COMMAND)
+    {
+        if (_parseShape(argument, shape, response))
+        {
+            // The Shape is checked from a store of it's own, so it is not added.
+            ShapeStore query;
+            query.append(*shape);
+            _findOverlaps(query.getShape(0), overlaps);
+            appendNumbers(response, overlaps);
+        }
+    }
+    else if (name == REMOVE_COMMAND)
+    {
+        ShapeIndex index;
+        bool removed = parseNumber(argument, index) && removeShape(index);
+        response = removed ? DONE_RESPONSE : UNKNOWN_SHAPE_MESSAGE;
+    }
+    else if (name == TOTAL_AREA_COMMAND)
+    {
+        std::ostringstream area;
+        area << std::fixed << std::setprecision(DECIMAL_POINT_PRECISION) << getTotalArea();
+        response = area.str();
+    }
+    else if (name == SHUTDOWN_COMMAND)
+    {
+        response = DONE_RESPONSE;
+        return false;
+    }
+    else
+    {
+        response = UNKNOWN_COMMAND_MESSAGE;
+    }
+
+    // The Shape of the command was copied to the store, so it's memory is not needed anymore.
+    _arena.reset();
+    return true;
+}
+
+/**
+ * @brief Read what the given client sent, and answer every command which ended.
+ * @param client The client to read from.
+ * @param running Set to false if the client stopped the service.
+ * @return true if the client is still connected, false otherwise.
+ */
+bool ShapeService::_serveClient(ServiceClient& client, bool& running)
+{
+    ssize_t count;
+    do
+    {
+        count = read(client.socket, _chunk.data(), _chunk.size());
+    }
+    while (count < 0 && errno == EINTR);
+    if (count <= 0)
+    {
+        return false;
+    }
+    client.pending.append(_chunk.data(), (size_t) count);
+
+    // Every whole line is a command, and a partial line waits for the rest of it.
+    std::string response;
+    size_t begin = 0;
+    size_t end;
+    while ((end = client.pending.find(LINE_END, begin)) != std::string::npos)
+    {
+        LineSpan line = {client.pending.data() + begin, end - begin};
+        begin = end + 1;
+        if (client.skipping)
+        {
+            // This is the end of a command which was already answered as too long.
+            client.skipping = false;
+            continue;
+        }
+        if (line.length > 0 && line.begin[line.length - 1] == CARRIAGE_RETURN)
+        {
+            line.length--;
+        }
+        if (line.length == 0)
+        {
+            continue;
+        }
+
+        if (line.length > MAX_COMMAND_LENGTH)
+        {
+            response = LONG_COMMAND_MESSAGE;
+        }
+        else
+        {
+            running = handleCommand(line, response);
+        }
+        response.push_back(LINE_END);
+        if (!sendAll(client.socket, response))
+        {
+            return false;
+        }
+        if (!running)
+        {
+            return true;
+        }
+    }
+    client.pending.erase(0, begin);
+
+    // A command which grows past the largest length is answered at once, and the rest of it is
+    // skipped as it arrives, so it is never kept in the memory.
+    if (client.pending.size() > MAX_COMMAND_LENGTH)
+    {
+        client.pending.clear();
+        if (!client.skipping)
+        {
+            client.skipping = true;
+            response = LONG_COMMAND_MESSAGE;
+            response.push_back(LINE_END);
+            return sendAll(client.socket, response);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Listen on a Unix socket in the given path and answer the commands of all the clients
+ *        which connect, in the order the commands arrive, until a client stops the service.
+ *        A socket which was left in the path is replaced, but any other file in the path is
+ *        kept.
+ * @param socketPath The path of the socket.
+ * @return true if the service was stopped by a command, false if the socket failed.
+ */
+bool ShapeService::serve(const char *socketPath)
+{
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (strlen(socketPath) >= sizeof(address.sun_path))
+    {
+        return false;
+    }
+    strcpy(address.sun_path, socketPath);
+
+    // Only a socket which was left by an earlier service is removed, never a regular file.
+    struct stat info;
+    if (lstat(socketPath, &info) == 0 && S_ISSOCK(info.st_mode))
+    {
+        unlink(socketPath);
+    }
+
+    int server = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (server < 0)
+    {
+        return false;
+    }
+    if (bind(server, (const sockaddr *) &address, sizeof(address)) < 0 ||
+        listen(server, SERVICE_BACKLOG) < 0)
+    {
+        close(server);
+        return false;
+    }
+
+    // The first polled socket is the server, and the rest are the clients in their order.
+    std::vector<ServiceClient> clients;
+    std::vector<pollfd> sockets;
+    bool running = true;
+    while (running)
+    {
+        sockets.assign(1, {server, POLLIN, 0});
+        for (auto i = clients.begin(); i != clients.end(); i++)
+        {
+            sockets.push_back({i -> socket, POLLIN, 0});
+        }
+        if (poll(sockets.data(), sockets.size(), -1) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            break;
+        }
+
+        size_t kept = 0;
+        for (size_t i = 0; i < clients.size(); i++)
+        {
+            bool connected = true;
+            if (running && sockets[i + 1].revents != 0)
+            {
+                connected = _serveClient(clients[i], running);
+            }
+            if (connected)
+            {
+                std::swap(clients[kept++], clients[i]);
+            }
+            else
+            {
+                close(clients[i].socket);
+            }
+        }
+        clients.erase(clients.begin() + kept, clients.end());
+
+        if (running && (sockets[0].revents & POLLIN))
+        {
+            int client = accept(server, nullptr, nullptr);
+            if (client >= 0)
+            {
+                clients.push_back({client, std::string(), false});
+            }
+            else if (errno != EINTR && errno != ECONNABORTED)
+            {
+                break;
+            }
+        }
+    }
+    for (auto i = clients.begin(); i != clients.end(); i++)
+    {
+        close(i -> socket);
+    }
+    close(server);
+    unlink(socketPath);
+    return !running;
+}
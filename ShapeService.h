@@ -0,0 +1,176 @@
+/**
+ * @file ShapeService.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header File for the ShapeService Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the ShapeService Class.
+ * Declaring the ShapeService Class, it's methods and fields.
+ * A ShapeService class keeps a live set of Shapes and a Spatial Grid over them in memory, and
+ * answers commands which arrive as lines over a local Unix socket from several clients at once.
+ * A new Shape is checked only against the Shapes which the grid finds around it, so an edit never
+ * checks the whole set again.
+ * The commands are:
+ *      add <Shape line>            Add the Shape, and answer it's number and the numbers of the
+ *                                  live Shapes which intersect it.
+ *      remove <number>             Remove the Shape with the given number.
+ *      query-overlap <Shape line>  Answer the numbers of the live Shapes which intersect the
+ *                                  Shape, without adding it.
+ *      total-area                  Answer the total area of all the live Shapes.
+ *      shutdown                    Stop the service.
+ * A Shape line has the same format as a line of the input file, and the Shapes are numbered in
+ * the order they were added, starting from 1. Every answer is a single line, where the numbers
+ * are separated by tabs. A command line which is too long is answered with an error.
+ */
+
+
+#ifndef SHAPESERVICE_H
+#define SHAPESERVICE_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "ShapeStore.h"
+#include "ShapeParser.h"
+#include "SpatialGrid.h"
+#include "ShapeArena.h"
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief A Struct representing a client which is connected to the service.
+ */
+struct ServiceClient
+{
+    int socket;            // The socket of the client.
+    std::string pending;   // The start of a command which did not end yet.
+    bool skipping;         // true while the rest of a command which is too long is skipped.
+};
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class representing a service which keeps a live set of Shapes and answers commands
+ *        about them over a local Unix socket.
+ */
+class ShapeService
+{
+public:
+
+    /**
+     * @brief A Constructor for the ShapeService, which creates a service with no Shapes.
+     */
+    ShapeService();
+
+    /**
+     * @brief Add the given Shape to the live Shapes, after finding the live Shapes which
+     *        intersect it.
+     * @param shape The Shape to add.
+     * @param overlaps The Vector which the indices of the intersecting Shapes are added to, in
+     *        their order.
+     * @return The index of the added Shape, which is it's position in the order the Shapes were
+     *         added.
+     */
+    ShapeIndex addShape(const Shape& shape, std::vector<ShapeIndex>& overlaps);
+
+    /**
+     * @brief Remove the Shape in the given index from the live Shapes. The removed Shapes are
+     *        dropped from the memory when the grid is built again.
+     * @param index The index of the Shape, which is it's position in the order the Shapes were
+     *        added.
+     * @return true if the Shape was live and is removed, false otherwise.
+     */
+    bool removeShape(ShapeIndex const index);
+
+    /**
+     * @brief Calculate the total area of all the live Shapes, adding the areas in the order the
+     *        Shapes were added.
+     * @return The total area of the live Shapes.
+     */
+    CordType getTotalArea() const;
+
+    /**
+     * @brief Run the given command and write it's answer, without the end of the line.
+     * @param command The line of the command.
+     * @param response The string to write the answer to.
+     * @return true if the service should keep running, false if the command stops it.
+     */
+    bool handleCommand(const LineSpan& command, std::string& response);
+
+    /**
+     * @brief Listen on a Unix socket in the given path and answer the commands of all the clients
+     *        which connect, in the order the commands arrive, until a client stops the service.
+     *        A socket which was left in the path is replaced, but any other file in the path is
+     *        kept.
+     * @param socketPath The path of the socket.
+     * @return true if the service was stopped by a command, false if the socket failed.
+     */
+    bool serve(const char *socketPath);
+
+private:
+    // ShapeService Private Fields.
+    ShapeStore _shapes;                     // The Shapes which were added since the last build.
+    std::vector<bool> _live;                // true for every Shape which was not removed.
+    std::vector<ShapeIndex> _indices;       // The index of every Shape, from the smallest.
+    ShapeIndex _nextIndex;                  // The index of the next added Shape.
+    ShapeIndex _removedCount;               // The amount of removed Shapes in the store.
+    std::unique_ptr<SpatialGrid> _grid;     // The grid which holds all the stored Shapes.
+    ShapeIndex _capacity;                   // The amount of Shapes which causes the next build.
+    size_t _oversizedLimit;                 // The amount of oversized Shapes which causes a build.
+    std::vector<char> _chunk;               // The buffer which is read from a client into.
+    std::vector<ShapeIndex> _candidates;    // The Shapes which the last query found.
+    ShapeArena _arena;                      // The arena which holds the Shape of a command.
+
+    /**
+     * @brief Drop the removed Shapes from the store, and build the grid again from the live
+     *        Shapes with a cell size which fits them.
+     */
+    void _rebuild();
+
+    /**
+     * @brief Find the live Shapes which intersect the given Shape.
+     * @param shape The Shape to check.
+     * @param overlaps The Vector which the indices of the intersecting Shapes are added to, in
+     *        their order.
+     */
+    void _findOverlaps(const ShapeView& shape, std::vector<ShapeIndex>& overlaps);
+
+    /**
+     * @brief Parse the Shape in the given line, and write an error to the answer if it is not a
+     *        valid Shape.
+     * @param line The line of the Shape.
+     * @param shape The parsed Shape, which is created in the arena of the service.
+     * @param response The string to write an error to.
+     * @return true if the line holds a valid Shape, false otherwise.
+     */
+    bool _parseShape(const LineSpan& line, ShapeP& shape, std::string& response);
+
+    /**
+     * @brief Read what the given client sent, and answer every command which ended.
+     * @param client The client to read from.
+     * @param running Set to false if the client stopped the service.
+     * @return true if the client is still connected, false otherwise.
+     */
+    bool _serveClient(ServiceClient& client, bool& running);
+
+    // A service owns it's socket and it's Shapes, so it is never copied.
+    ShapeService(const ShapeService& other) = delete;
+    ShapeService& operator=(const ShapeService& other) = delete;
+};
+
+
+#endif
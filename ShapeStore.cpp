@@ -0,0 +1,411 @@
+/**
+ * @file ShapeStore.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A File for the ShapeStore and ShapeView Classes implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the ShapeStore and ShapeView Classes implementation.
+ * Define the ShapeStore and ShapeView Classes, their methods and fields.
+ * A ShapeStore class holds many Shapes as continuous columns: the X and Y coordinates and the
+ * edge lines of all the Vertices, the index of the first Vertex of every Shape, the type tags, the
+ * areas and the Bounding Boxes. A ShapeView class is a light view of a single Shape in the store,
+ * which the intersection checks run on without reaching any memory outside the columns.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include "ShapeKernels.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def FIRST_VERTEX 0
+ * @brief A Macro that sets the index of the first Vertex of a Shape.
+ */
+#define FIRST_VERTEX 0
+
+/**
+ * @def MAX_OVERLAP_VERTICES 8
+ * @brief A Macro that sets the largest amount of Vertices of a Shape which the sides of it's
+ *        Vertices are kept for in the overlap check. Larger Shapes are checked edge by edge.
+ */
+#define MAX_OVERLAP_VERTICES 8
+
+
+/*-----=  ShapeView Helpers  =-----*/
+
+
+/**
+ * @brief Returns the index of the Vertex after the given Vertex, where the last Vertex is
+ *        followed by the first Vertex.
+ * @param vertex The index of the current Vertex.
+ * @param vertexCount The amount of Vertices of the Shape.
+ * @return The index of the next Vertex.
+ */
+static inline ShapeSize nextVertex(ShapeSize const vertex, ShapeSize const vertexCount)
+{
+    return vertex + 1 == vertexCount ? FIRST_VERTEX : vertex + 1;
+}
+
+
+/**
+ * @brief Determine if any Vertex of a Shape is inside another Shape, using the sides of the
+ *        Vertices according to the edges of the other Shape.
+ * @param sides The value of the line of edge k in Vertex i is in sides[k][i].
+ * @param vertexCount The amount of Vertices of the Shape.
+ * @param edgeCount The amount of edges of the other Shape.
+ * @return true if a Vertex of the Shape is inside the other Shape, false otherwise.
+ */
+static bool hasVertexInside(const CordType sides[][MAX_OVERLAP_VERTICES],
+                            ShapeSize const vertexCount, ShapeSize const edgeCount)
+{
+    // 'inside' holds the Vertices which appeared on the same side of all the edges so far, and
+    // 'firstSides' holds the side of every Vertex according to the first edge.
+    VertexMask inside = ((VertexMask) 1 << vertexCount) - 1;
+    VertexMask firstSides = 0;
+    for (ShapeSize k = FIRST_VERTEX; k < edgeCount; k++)
+    {
+        VertexMask edgeSides = 0;
+        for (ShapeSize i = FIRST_VERTEX; i < vertexCount; i++)
+        {
+            // True for right-side, false for left-side.
+            edgeSides |= (VertexMask) (sides[k][i] < 0) << i;
+        }
+        if (k == FIRST_VERTEX)
+        {
+            firstSides = edgeSides;
+        }
+        else
+        {
+            inside &= ~(edgeSides ^ firstSides);
+            if (inside == 0)
+            {
+                return false;
+            }
+        }
+    }
+    return inside != 0;
+}
+
+
+/*-----=  ShapeView Methods  =-----*/
+
+
+/**
+ * @brief Determine if an edge of a given Shape crosses an edge of this Shape.
+ * @param other The Shape to check intersection with.
+ * @return true if the Shapes intersect, false otherwise.
+ */
+bool ShapeView::intersectWith(const ShapeView& other) const
+{
+    for (ShapeSize i = FIRST_VERTEX; i < _vertexCount; i++)
+    {
+        ShapeSize j = nextVertex(i, _vertexCount);
+        for (ShapeSize k = FIRST_VERTEX; k < other._vertexCount; k++)
+        {
+            ShapeSize l = nextVertex(k, other._vertexCount);
+            if (edgesIntersectHelper(_x[i], _y[i], _x[j], _y[j], other._edges[k]) &&
+                edgesIntersectHelper(other._x[k], other._y[k], other._x[l], other._y[l],
+                                     _edges[i]))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Determine if the given Point appears on the same side of all the edges of this
+ *        Shape, i.e. the Point is inside this Shape.
+ * @param x The X coordinate of the Point.
+ * @param y The Y coordinate of the Point.
+ * @return true if the Point appears on the same side of all the edges, false otherwise.
+ */
+bool ShapeView::_containsVertex(CordType const x, CordType const y) const
+{
+    bool firstSide = false;
+    for (ShapeSize i = FIRST_VERTEX; i < _vertexCount; i++)
+    {
+        CordType k = _edges[i].valueAt(x, y);
+        bool side = k < 0;  // True for right-side, false for left-side.
+        if (i == FIRST_VERTEX)
+        {
+            firstSide = side;
+        }
+        else if (side != firstSide)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Determine if any Vertex of this Shape is inside the given other Shape, checking all
+ *        the Vertices together in a single pass over the edges of the other Shape.
+ * @param other The Shape to check with.
+ * @return true if a Vertex of this Shape is inside the other Shape, false otherwise.
+ */
+bool ShapeView::_hasVertexInside(const ShapeView& other) const
+{
+    if (_vertexCount > MAX_BATCH_VERTICES)
+    {
+        for (ShapeSize i = FIRST_VERTEX; i < _vertexCount; i++)
+        {
+            if (other._containsVertex(_x[i], _y[i]))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // All the Vertices are checked together in a single pass over the edges of the other Shape.
+    // 'inside' holds the Vertices which appeared on the same side of all the edges so far, and
+    // 'sides' holds the side of every Vertex according to the first edge.
+    VertexMask inside = _vertexCount == MAX_BATCH_VERTICES ? ~(VertexMask) 0 :
+                        (((VertexMask) 1 << _vertexCount) - 1);
+    VertexMask sides = 0;
+    for (ShapeSize k = FIRST_VERTEX; k < other._vertexCount; k++)
+    {
+        const EdgeLine& line = other._edges[k];
+        VertexMask edgeSides = 0;
+        for (ShapeSize i = FIRST_VERTEX; i < _vertexCount; i++)
+        {
+            // True for right-side, false for left-side.
+            edgeSides |= (VertexMask) (line.valueAt(_x[i], _y[i]) < 0) << i;
+        }
+        if (k == FIRST_VERTEX)
+        {
+            sides = edgeSides;
+        }
+        else
+        {
+            inside &= ~(edgeSides ^ sides);
+            if (inside == 0)
+            {
+                return false;
+            }
+        }
+    }
+    return inside != 0;
+}
+
+/**
+ * @brief Determine if this Shape is a sub-set of a given other Shape or
+ *        if the other Shape is a sub-set of this Shape.
+ *        By sub-set of we mean that there exist a Point from one Shape that is inside the
+ *        other Shapes boundaries.
+ * @param other The Shape to check sub-set with.
+ * @return true if one of the Shapes is a sub-set of the other Shape, false otherwise.
+ */
+bool ShapeView::subsetOf(const ShapeView& other) const
+{
+    return _hasVertexInside(other) || other._hasVertexInside(*this);
+}
+
+/**
+ * @brief Determine if a given Shape intersects this Shape, i.e. an edge of one Shape crosses an
+ *        edge of the other Shape, or one Shape is a sub-set of the other Shape.
+ *        The side of every Vertex according to every edge of the other Shape is calculated
+ *        once, and both checks use it. The result is the same as calling intersectWith and
+ *        then subsetOf.
+ * @param other The Shape to check with.
+ * @return true if the Shapes intersect, false otherwise.
+ */
+bool ShapeView::overlaps(const ShapeView& other) const
+{
+    if (_vertexCount > MAX_OVERLAP_VERTICES || other._vertexCount > MAX_OVERLAP_VERTICES)
+    {
+        return intersectWith(other) || subsetOf(other);
+    }
+
+    // The value of the line of edge k of the other Shape in Vertex i of this Shape is kept in
+    // sides[k][i], and the value of the line of edge i of this Shape in Vertex k of the other
+    // Shape is kept in otherSides[i][k].
+    CordType sides[MAX_OVERLAP_VERTICES][MAX_OVERLAP_VERTICES];
+    CordType otherSides[MAX_OVERLAP_VERTICES][MAX_OVERLAP_VERTICES];
+    for (ShapeSize k = FIRST_VERTEX; k < other._vertexCount; k++)
+    {
+        for (ShapeSize i = FIRST_VERTEX; i < _vertexCount; i++)
+        {
+            sides[k][i] = other._edges[k].valueAt(_x[i], _y[i]);
+        }
+    }
+    for (ShapeSize i = FIRST_VERTEX; i < _vertexCount; i++)
+    {
+        for (ShapeSize k = FIRST_VERTEX; k < other._vertexCount; k++)
+        {
+            otherSides[i][k] = _edges[i].valueAt(other._x[k], other._y[k]);
+        }
+    }
+
+    // Edge i crosses edge k when it's Points are on different sides of the line of edge k, and
+    // the Points of edge k are on different sides of the line of edge i.
+    for (ShapeSize i = FIRST_VERTEX; i < _vertexCount; i++)
+    {
+        ShapeSize j = nextVertex(i, _vertexCount);
+        for (ShapeSize k = FIRST_VERTEX; k < other._vertexCount; k++)
+        {
+            ShapeSize l = nextVertex(k, other._vertexCount);
+            if (sides[k][i] * sides[k][j] < 0 && otherSides[i][k] * otherSides[i][l] < 0)
+            {
+                return true;
+            }
+        }
+    }
+    return hasVertexInside(sides, _vertexCount, other._vertexCount) ||
+           hasVertexInside(otherSides, other._vertexCount, _vertexCount);
+}
+
+
+/*-----=  ShapeStore Constructors  =-----*/
+
+
+/**
+ * @brief A Constructor for the ShapeStore, which creates an empty store.
+ */
+ShapeStore::ShapeStore() : _offsets(1, FIRST_VERTEX)
+{
+
+}
+
+
+/*-----=  ShapeStore Methods  =-----*/
+
+
+/**
+ * @brief Add a copy of the given Shape to the end of the store.
+ * @param shape The Shape to add.
+ */
+void ShapeStore::append(const Shape& shape)
+{
+    const PointVector& points = shape.getPoints();
+    for (auto i = points.begin(); i != points.end(); i++)
+    {
+        _x.push_back(i -> getX());
+        _y.push_back(i -> getY());
+    }
+    const EdgeLineVector& edges = shape.getEdges();
+    _edges.insert(_edges.end(), edges.begin(), edges.end());
+    _offsets.push_back(_x.size());
+    _types.push_back((TypeTag) getShapeType(shape));
+    _areas.push_back(shape.getArea());
+    _boxes.push_back(shape.getBoundingBox());
+}
+
+/**
+ * @brief Add a copy of all the given Shapes to the end of the store, in their order.
+ * @param shapes The Shapes to add.
+ */
+void ShapeStore::append(const ShapeVector& shapes)
+{
+    size_t vertexCount = _x.size();
+    for (auto i = shapes.begin(); i != shapes.end(); i++)
+    {
+        vertexCount += (*i) -> getPoints().size();
+    }
+    size_t shapeCount = size() + shapes.size();
+
+    _x.reserve(vertexCount);
+    _y.reserve(vertexCount);
+    _edges.reserve(vertexCount);
+    _offsets.reserve(shapeCount + 1);
+    _types.reserve(shapeCount);
+    _areas.reserve(shapeCount);
+    _boxes.reserve(shapeCount);
+    for (auto i = shapes.begin(); i != shapes.end(); i++)
+    {
+        append(**i);
+    }
+}
+
+/**
+ * @brief Remove every Shape which is not kept from the store, keeping the order of the other
+ *        Shapes.
+ * @param keep true for every Shape in the store which is kept.
+ */
+void ShapeStore::compact(const std::vector<bool>& keep)
+{
+    // A kept Shape only moves towards the start of the columns, so it never overwrites a Shape
+    // which was not moved yet.
+    ShapeIndex kept = 0;
+    size_t vertexCount = FIRST_VERTEX;
+    for (ShapeIndex i = 0; i < size(); i++)
+    {
+        if (!keep[i])
+        {
+            continue;
+        }
+        size_t first = _offsets[i];
+        size_t last = _offsets[i + 1];
+        std::copy(_x.begin() + first, _x.begin() + last, _x.begin() + vertexCount);
+        std::copy(_y.begin() + first, _y.begin() + last, _y.begin() + vertexCount);
+        std::copy(_edges.begin() + first, _edges.begin() + last, _edges.begin() + vertexCount);
+        vertexCount += last - first;
+        _offsets[kept + 1] = vertexCount;
+        _types[kept] = _types[i];
+        _areas[kept] = _areas[i];
+        _boxes[kept] = _boxes[i];
+        kept++;
+    }
+
+    _x.resize(vertexCount);
+    _y.resize(vertexCount);
+    _edges.resize(vertexCount);
+    _offsets.resize(kept + 1);
+    _types.resize(kept);
+    _areas.resize(kept);
+    _boxes.resize(kept);
+}
+
+/**
+ * @brief Calculate the total area of all the Shapes in the store.
+ * @return the sum of all the Shapes' area.
+ */
+CordType ShapeStore::getTotalArea() const
+{
+    CordType result = EMPTY_SHAPE_SIZE;
+    for (auto i = _areas.begin(); i != _areas.end(); i++)
+    {
+        result += *i;
+    }
+    return result;
+}
+
+/**
+ * @brief Prints a representation of the Shape in the given index, the same way the Shape
+ *        itself prints it.
+ * @param index The index of the Shape.
+ */
+void ShapeStore::printShape(ShapeIndex const index) const
+{
+    const CordType *x = _x.data() + _offsets[index];
+    const CordType *y = _y.data() + _offsets[index];
+
+    switch (getType(index))
+    {
+        case TRIANGLE:
+            printTrig(x[0], y[0], x[1], y[1], x[2], y[2]);
+            break;
+
+        case TRAPEZOID:
+            printTrapez(x[0], y[0], x[1], y[1], x[2], y[2], x[3], y[3]);
+            break;
+
+        default:
+            break;
+    }
+}
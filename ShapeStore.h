@@ -0,0 +1,269 @@
+/**
+ * @file ShapeStore.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header File for the ShapeStore and ShapeView Classes.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the ShapeStore and ShapeView Classes.
+ * Declaring the ShapeStore and ShapeView Classes, their methods and fields.
+ * A ShapeStore class holds many Shapes as continuous columns: the X and Y coordinates and the
+ * edge lines of all the Vertices, the index of the first Vertex of every Shape, the type tags, the
+ * areas and the Bounding Boxes. A ShapeView class is a light view of a single Shape in the store,
+ * which the intersection checks run on without reaching any memory outside the columns.
+ */
+
+
+#ifndef SHAPESTORE_H
+#define SHAPESTORE_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cstdint>
+#include <vector>
+#include "ShapeFactory.h"
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief TypeTag is the ShapeType of a Shape in the store, kept in a single byte.
+ */
+typedef uint8_t TypeTag;
+
+
+/*-----=  Class Declarations  =-----*/
+
+
+/**
+ * @brief A Class representing a view of a single Shape in a ShapeStore.
+ *        The view points into the columns of the store, so it is valid until Shapes are added.
+ *        The intersection checks of the view give the same results as the checks of the Shape
+ *        Class, using the same calculations in the same order.
+ */
+class ShapeView
+{
+public:
+
+    /**
+     * @brief A Constructor for the ShapeView.
+     * @param type The type of the Shape.
+     * @param x The X coordinates of the Vertices of the Shape.
+     * @param y The Y coordinates of the Vertices of the Shape.
+     * @param edges The lines of the edges of the Shape.
+     * @param vertexCount The amount of Vertices of the Shape.
+     * @param box The Bounding Box of the Shape.
+     */
+    ShapeView(ShapeType const type, const CordType *x, const CordType *y, const EdgeLine *edges,
+              ShapeSize const vertexCount, const BoundingBox& box) :
+              _type(type), _x(x), _y(y), _edges(edges), _vertexCount(vertexCount), _box(&box)
+    {
+
+    };
+
+    /**
+     * @brief Returns the type of the Shape.
+     * @return The type of the Shape.
+     */
+    ShapeType getType() const { return _type; };
+
+    /**
+     * @brief Returns the amount of Vertices of the Shape.
+     * @return The amount of Vertices of the Shape.
+     */
+    ShapeSize getVertexCount() const { return _vertexCount; };
+
+    /**
+     * @brief Returns the X coordinate of the given Vertex.
+     * @param vertex The index of the Vertex.
+     * @return The X coordinate of the Vertex.
+     */
+    CordType getX(ShapeSize const vertex) const { return _x[vertex]; };
+
+    /**
+     * @brief Returns the Y coordinate of the given Vertex.
+     * @param vertex The index of the Vertex.
+     * @return The Y coordinate of the Vertex.
+     */
+    CordType getY(ShapeSize const vertex) const { return _y[vertex]; };
+
+    /**
+     * @brief Returns the line of the edge from the given Vertex to the next Vertex.
+     * @param vertex The index of the Vertex which the edge starts at.
+     * @return The line of the edge.
+     */
+    const EdgeLine& getEdge(ShapeSize const vertex) const { return _edges[vertex]; };
+
+    /**
+     * @brief Returns the Bounding Box of the Shape.
+     * @return The Bounding Box of the Shape.
+     */
+    const BoundingBox& getBoundingBox() const { return *_box; };
+
+    /**
+     * @brief Determine if an edge of a given Shape crosses an edge of this Shape.
+     * @param other The Shape to check intersection with.
+     * @return true if the Shapes intersect, false otherwise.
+     */
+    bool intersectWith(const ShapeView& other) const;
+
+    /**
+     * @brief Determine if this Shape is a sub-set of a given other Shape or
+     *        if the other Shape is a sub-set of this Shape.
+     *        By sub-set of we mean that there exist a Point from one Shape that is inside the
+     *        other Shapes boundaries.
+     * @param other The Shape to check sub-set with.
+     * @return true if one of the Shapes is a sub-set of the other Shape, false otherwise.
+     */
+    bool subsetOf(const ShapeView& other) const;
+
+    /**
+     * @brief Determine if a given Shape intersects this Shape, i.e. an edge of one Shape crosses an
+     *        edge of the other Shape, or one Shape is a sub-set of the other Shape.
+     *        The side of every Vertex according to every edge of the other Shape is calculated
+     *        once, and both checks use it. The result is the same as calling intersectWith and
+     *        then subsetOf.
+     * @param other The Shape to check with.
+     * @return true if the Shapes intersect, false otherwise.
+     */
+    bool overlaps(const ShapeView& other) const;
+
+private:
+    // ShapeView Private Fields.
+    ShapeType _type;            // The type of the Shape.
+    const CordType *_x;         // The X coordinates of the Vertices.
+    const CordType *_y;         // The Y coordinates of the Vertices.
+    const EdgeLine *_edges;     // The lines of the edges.
+    ShapeSize _vertexCount;     // The amount of Vertices.
+    const BoundingBox *_box;    // The Bounding Box of the Shape.
+
+    /**
+     * @brief Determine if the given Point appears on the same side of all the edges of this
+     *        Shape, i.e. the Point is inside this Shape.
+     * @param x The X coordinate of the Point.
+     * @param y The Y coordinate of the Point.
+     * @return true if the Point appears on the same side of all the edges, false otherwise.
+     */
+    bool _containsVertex(CordType const x, CordType const y) const;
+
+    /**
+     * @brief Determine if any Vertex of this Shape is inside the given other Shape, checking all
+     *        the Vertices together in a single pass over the edges of the other Shape.
+     * @param other The Shape to check with.
+     * @return true if a Vertex of this Shape is inside the other Shape, false otherwise.
+     */
+    bool _hasVertexInside(const ShapeView& other) const;
+};
+
+/**
+ * @brief A Class representing a container of Shapes which keeps every property of the Shapes in
+ *        it's own continuous column, so a scan over the Shapes reads only the columns it needs.
+ */
+class ShapeStore
+{
+public:
+
+    /**
+     * @brief A Constructor for the ShapeStore, which creates an empty store.
+     */
+    ShapeStore();
+
+    /**
+     * @brief Returns the amount of Shapes in the store.
+     * @return The amount of Shapes in the store.
+     */
+    ShapeIndex size() const { return _types.size(); };
+
+    /**
+     * @brief Determine if the store holds no Shapes.
+     * @return true if the store is empty, false otherwise.
+     */
+    bool empty() const { return _types.empty(); };
+
+    /**
+     * @brief Add a copy of the given Shape to the end of the store.
+     * @param shape The Shape to add.
+     */
+    void append(const Shape& shape);
+
+    /**
+     * @brief Add a copy of all the given Shapes to the end of the store, in their order.
+     * @param shapes The Shapes to add.
+     */
+    void append(const ShapeVector& shapes);
+
+    /**
+     * @brief Remove every Shape which is not kept from the store, keeping the order of the
+     *        other Shapes.
+     * @param keep true for every Shape in the store which is kept.
+     */
+    void compact(const std::vector<bool>& keep);
+
+    /**
+     * @brief Returns a view of the Shape in the given index.
+     * @param index The index of the Shape.
+     * @return A view of the Shape.
+     */
+    ShapeView getShape(ShapeIndex const index) const
+    {
+        size_t first = _offsets[index];
+        return ShapeView(getType(index), _x.data() + first, _y.data() + first,
+                         _edges.data() + first, (ShapeSize) (_offsets[index + 1] - first),
+                         _boxes[index]);
+    };
+
+    /**
+     * @brief Returns the type of the Shape in the given index.
+     * @param index The index of the Shape.
+     * @return The type of the Shape.
+     */
+    ShapeType getType(ShapeIndex const index) const { return (ShapeType) _types[index]; };
+
+    /**
+     * @brief Returns the area of the Shape in the given index.
+     * @param index The index of the Shape.
+     * @return The area of the Shape.
+     */
+    CordType getArea(ShapeIndex const index) const { return _areas[index]; };
+
+    /**
+     * @brief Returns the Bounding Box of the Shape in the given index.
+     * @param index The index of the Shape.
+     * @return The Bounding Box of the Shape.
+     */
+    const BoundingBox& getBoundingBox(ShapeIndex const index) const { return _boxes[index]; };
+
+    /**
+     * @brief Calculate the total area of all the Shapes in the store.
+     * @return the sum of all the Shapes' area.
+     */
+    CordType getTotalArea() const;
+
+    /**
+     * @brief Prints a representation of the Shape in the given index, the same way the Shape
+     *        itself prints it.
+     * @param index The index of the Shape.
+     */
+    void printShape(ShapeIndex const index) const;
+
+private:
+    // ShapeStore Private Fields.
+    std::vector<CordType> _x;            // The X coordinates of the Vertices of all the Shapes.
+    std::vector<CordType> _y;            // The Y coordinates of the Vertices of all the Shapes.
+    std::vector<EdgeLine> _edges;        // The lines of the edges of all the Shapes.
+    std::vector<size_t> _offsets;        // The index of the first Vertex of every Shape.
+    std::vector<TypeTag> _types;         // The type of every Shape.
+    std::vector<CordType> _areas;        // The area of every Shape.
+    std::vector<BoundingBox> _boxes;     // The Bounding Box of every Shape.
+};
+
+
+#endif
@@ -41,6 +41,19 @@
 #include <fstream>
 #include <iomanip>
 #include "ShapeFactory.h"
+#include "ShapeStore.h"
+#include "InputReader.h"
+#include "ShapeParser.h"
+#include "ShapeBinary.h"
+#include "StreamChecker.h"
+#include "SweepLine.h"
+#include "SpatialGrid.h"
+#include "RTree.h"
+#include "OutputBuffer.h"
+#include "ShapeService.h"
+#include "PointLocator.h"
+#include "UnionArea.h"
+#include "SpatialJoin.h"
 
 
 /*-----=  Definitions  =-----*/
@@ -82,6 +95,38 @@
  */
 #define OUTPUT_FILE_INDEX 2
 
+/**
+ * @def SOCKET_PATH_INDEX 1
+ * @brief A Macro that sets the index of the socket path of the service in the given arguments.
+ */
+#define SOCKET_PATH_INDEX 1
+
+/**
+ * @def SCENE_FILE_INDEX 2
+ * @brief A Macro that sets the index of the input file which the service starts with in the
+ *        given arguments.
+ */
+#define SCENE_FILE_INDEX 2
+
+/**
+ * @def POINTS_FILE_INDEX 2
+ * @brief A Macro that sets the index of the Points file path in the given arguments.
+ */
+#define POINTS_FILE_INDEX 2
+
+/**
+ * @def SECOND_INPUT_FILE_INDEX 2
+ * @brief A Macro that sets the index of the second input file of a join in the given arguments.
+ */
+#define SECOND_INPUT_FILE_INDEX 2
+
+/**
+ * @def MAX_MODES 1
+ * @brief A Macro that sets the largest amount of mode options, i.e. '--convert', '--stream',
+ *        '--serve', '--locate' and '--join', which can be given together.
+ */
+#define MAX_MODES 1
+
 /**
  * @def START_INDEX 0
  * @brief A Macro that sets the value for the start index in the input.
@@ -89,16 +134,120 @@
 #define START_INDEX 0
 
 /**
- * @def SHAPE_TYPE_INDEX 0
- * @brief A Macro that sets the index of the Shape's type in the given line from a file.
+ * @def EMPTY_LINE_LENGTH 0
+ * @brief A Macro that sets the length of an empty line in the input.
+ */
+#define EMPTY_LINE_LENGTH 0
+
+/**
+ * @def OPTION_PREFIX "--"
+ * @brief A Macro that sets the prefix of an option in the given arguments.
+ */
+#define OPTION_PREFIX "--"
+
+/**
+ * @def SWEEP_OPTION "--sweep"
+ * @brief A Macro that sets the option which finds the intersection using the Sweep Line.
+ */
+#define SWEEP_OPTION "--sweep"
+
+/**
+ * @def GRID_OPTION "--grid"
+ * @brief A Macro that sets the option which finds the intersection using the Spatial Grid.
+ */
+#define GRID_OPTION "--grid"
+
+/**
+ * @def RTREE_OPTION "--rtree"
+ * @brief A Macro that sets the option which finds the intersection using the R-Tree.
+ */
+#define RTREE_OPTION "--rtree"
+
+/**
+ * @def STREAM_OPTION "--stream"
+ * @brief A Macro that sets the option which checks every Shape as soon as it is read, and reports
+ *        the intersecting pair with the smallest second index.
+ */
+#define STREAM_OPTION "--stream"
+
+/**
+ * @def STANDARD_INPUT_PATH "-"
+ * @brief A Macro that sets the input file path which stands for the standard input.
+ */
+#define STANDARD_INPUT_PATH "-"
+
+/**
+ * @def CONVERT_OPTION "--convert"
+ * @brief A Macro that sets the option which converts the input file to a binary Shapes file.
+ */
+#define CONVERT_OPTION "--convert"
+
+/**
+ * @def ALL_PAIRS_OPTION "--all-pairs"
+ * @brief A Macro that sets the option which reports every pair of intersecting Shapes.
+ */
+#define ALL_PAIRS_OPTION "--all-pairs"
+
+/**
+ * @def COUNT_OPTION "--count"
+ * @brief A Macro that sets the option which reports the amount of pairs of intersecting Shapes.
+ */
+#define COUNT_OPTION "--count"
+
+/**
+ * @def UNION_AREA_OPTION "--union-area"
+ * @brief A Macro that sets the option which reports the area of the union of the Shapes.
  */
-#define SHAPE_TYPE_INDEX 0
+#define UNION_AREA_OPTION "--union-area"
 
 /**
- * @def COORDINATES_SEPARATOR '\t'
- * @brief A Macro that sets the flag representing the separator between the Shape's coordinates.
+ * @def SERVE_OPTION "--serve"
+ * @brief A Macro that sets the option which runs the Shapes service on a Unix socket.
  */
-#define COORDINATES_SEPARATOR '\t'
+#define SERVE_OPTION "--serve"
+
+/**
+ * @def LOCATE_OPTION "--locate"
+ * @brief A Macro that sets the option which finds the Shape that contains every Point in a file.
+ */
+#define LOCATE_OPTION "--locate"
+
+/**
+ * @def JOIN_OPTION "--join"
+ * @brief A Macro that sets the option which reports the intersecting pairs between two files.
+ */
+#define JOIN_OPTION "--join"
+
+/**
+ * @def FIRST_SHAPE_NUMBER 1
+ * @brief A Macro that sets the number of the first Shape in a reported pair, so the Shapes are
+ *        numbered in their order in the input starting from 1.
+ */
+#define FIRST_SHAPE_NUMBER 1
+
+/**
+ * @def NO_SHAPE_NUMBER 0
+ * @brief A Macro that sets the number which is reported for a Point that no Shape contains.
+ */
+#define NO_SHAPE_NUMBER 0
+
+/**
+ * @def PAIR_SEPARATOR '\t'
+ * @brief A Macro that sets the separator between the numbers of the Shapes in a reported pair.
+ */
+#define PAIR_SEPARATOR '\t'
+
+/**
+ * @def PAIR_END '\n'
+ * @brief A Macro that sets the end of a reported pair, or of the reported Shape of a Point.
+ */
+#define PAIR_END '\n'
+
+/**
+ * @def UNION_AREA_MESSAGE "Union draws area:"
+ * @brief A Macro that sets the output message before the area of the union of the Shapes.
+ */
+#define UNION_AREA_MESSAGE "Union draws area:"
 
 /**
  * @def INVALID_ARGUMENTS_MESSAGE "Usage: Shapes <input_file_name> [<output_file_name>]"
@@ -106,6 +255,30 @@
  */
 #define INVALID_ARGUMENTS_MESSAGE "Usage: Shapes <input_file_name> [<output_file_name>]"
 
+/**
+ * @def OPTIONS_USAGE_MESSAGE
+ * @brief A Macro that sets the output message which lists the options, after an invalid option.
+ */
+#define OPTIONS_USAGE_MESSAGE \
+    "Options:\n" \
+    "  --sweep, --grid, --rtree  Find the first intersection using the Sweep Line, the Spatial\n" \
+    "                            Grid or the R-Tree. Without these options the Sweep Line is\n" \
+    "                            used on a single core, and the R-Tree on several cores.\n" \
+    "  --all-pairs, --count      Report every pair of intersecting Shapes, or their amount.\n" \
+    "  --union-area              Report the area of the union of the Shapes.\n" \
+    "  --stream                  Check every Shape as soon as it is read, where the input\n" \
+    "                            '-' is the standard input. The reported pair is the pair with\n" \
+    "                            the smallest second index, which may differ from the pair\n" \
+    "                            that is reported without this option.\n" \
+    "  --convert                 Convert the input file to a binary file in the output path.\n" \
+    "  --serve                   Serve commands on the Unix socket in the first path, starting\n" \
+    "                            with the Shapes of the optional input file after it.\n" \
+    "  --locate                  Report the Shape of every Point in the Points file after the\n" \
+    "                            input file.\n" \
+    "  --join                    Report the intersecting pairs of the two given input files.\n" \
+    "Only one of --stream, --convert, --serve, --locate and --join can be given, and none of\n" \
+    "them can be given with --all-pairs, --count or --union-area."
+
 /**
  * @def INVALID_FILE_MESSAGE "ERROR: Unable to open the file "
  * @brief A Macro that sets the output error message for invalid input file.
@@ -124,6 +297,19 @@
  */
 #define INVALID_SHAPE_MESSAGE "ERROR: Invalid Shape Type."
 
+/**
+ * @def INVALID_BINARY_MESSAGE "ERROR: Invalid binary Shapes file."
+ * @brief A Macro that sets the output error message for a damaged binary input file.
+ */
+#define INVALID_BINARY_MESSAGE "ERROR: Invalid binary Shapes file."
+
+/**
+ * @def ILLEGAL_POINT_MESSAGE "ERROR: Illegal Point"
+ * @brief A Macro that sets the output error message for a line of a Points file which does not
+ *        hold a Point.
+ */
+#define ILLEGAL_POINT_MESSAGE "ERROR: Illegal Point"
+
 /**
  * @def DECIMAL_POINT_PRECISION 2
  * @brief A Macro that sets the number of digits after the decimal point in a number representation.
@@ -131,13 +317,47 @@
 #define DECIMAL_POINT_PRECISION 2
 
 
+/*-----=  Enums  =-----*/
+
+
+/**
+ * @brief An Enum for the different engines which find the intersection between the Shapes.
+ */
+enum IntersectionEngine
+{
+    SWEEP_ENGINE,
+    GRID_ENGINE,
+    RTREE_ENGINE
+};
+
+/**
+ * @brief An Enum for the different reports of the intersections between the Shapes.
+ */
+enum IntersectionReport
+{
+    FIRST_PAIR_REPORT,
+    ALL_PAIRS_REPORT,
+    COUNT_REPORT,
+    UNION_AREA_REPORT
+};
+
+
 /*-----=  Type Definitions  =-----*/
 
 
 /**
- * @brief ShapeVector is the ShapeP Vector which is the Container of the pointers for Shapes.
+ * @brief A Struct representing the options that were given to the program in the arguments.
  */
-typedef std::vector<ShapeP> ShapeVector;
+struct Options
+{
+    IntersectionEngine engine;  // The engine which finds the intersection between the Shapes.
+    IntersectionReport report;  // The report of the intersections between the Shapes.
+    bool convert;               // true if the input is converted to a binary Shapes file.
+    bool stream;                // true if every Shape is checked as soon as it is read.
+    bool serve;                 // true if the Shapes service runs on a Unix socket.
+    bool locate;                // true if the Shape of every Point in a file is found.
+    bool join;                  // true if the intersecting pairs between two files are reported.
+};
 
 
 /*-----=  Input Handling & Processing  =-----*/
@@ -155,95 +375,40 @@ static inline void reportStreamError(const std::string& stringName)
 }
 
 /**
- * @brief Find the next coordinate in the given line and returns it's value as CordType.
- * @param currentLine The given line that contains data from the input stream.
- * @param currentIndex The current index in this process of analyzing the line.
- * @return A CordType which holds the value of the next coordinate.
- */
-static CordType getCoordinate(std::string& currentLine, size_t& currentIndex)
-{
-    // Find the next coordinate.
-    currentIndex = currentLine.find(COORDINATES_SEPARATOR);
-    CordType coordinate = stod(currentLine.substr(START_INDEX, currentIndex));
-
-    // Prepare the string for next call.
-    currentLine = currentLine.substr(currentIndex + 1);
-
-    return coordinate;
-}
-
-/**
- * @brief With a given line from the input stream, this function parse the line to the coordinates
- *        it holds. The function creates a Point from each set of coordinates and store it in the
- *        given Points Vector.
- * @param currentLine The given line that contains data from the input stream.
- * @param points The Points Vector which stores the Points for the current Shape.
+ * @brief Open the input file in the given path, where the path '-' stands for the standard input.
+ * @param inputFile The input file reader to open.
+ * @param path The path of the input file.
+ * @return true if the input file was opened successfully, false otherwise.
  */
-static void parseCoordinates(std::string& currentLine, PointVector& points)
+static bool openInput(InputReader& inputFile, const char *path)
 {
-    // Remove the redundant Token of the shape's type.
-    size_t currentIndex = currentLine.find(COORDINATES_SEPARATOR);
-    currentLine = currentLine.substr(currentIndex + 1);
-
-    // Start iterating over the shape's coordinates.
-    while (currentIndex != std::string::npos)
+    if (std::string(path) == STANDARD_INPUT_PATH)
     {
-        // Create the X and Y coordinates.
-        CordType x = getCoordinate(currentLine, currentIndex);
-        CordType y = getCoordinate(currentLine, currentIndex);
-
-        // Create the current Point and add it to the Points Vector.
-        Point currentPoint(x, y);
-        points.push_back(currentPoint);
+        return inputFile.openStandardInput();
     }
+    return inputFile.open(path);
 }
 
 /**
- * @brief Gets the Shape from the given line,
- *        The given line contains data of the current Shape, and the function creates the required
- *        Shape and returns a pointer for that Shape.
- * @param currentLine The current line in the input stream with the data of the Shape.
- * @return A pointer for the desired Shape, or NULL Pointer in case of an error.
+ * @brief Reports an error message to the standard error output for a line of the input which
+ *        does not hold a valid Shape.
+ * @param status The reason the line does not hold a valid Shape.
+ * @param shapeType The type of the Shape in the line.
  */
-static ShapeP getShape(std::string& currentLine)
+static void reportParseError(ParseStatus const status, ShapeType const shapeType)
 {
-    ShapeP pShape = nullptr;
-    PointVector points;
-
-    // Determine the shape's type.
-    char typeFlag = currentLine[SHAPE_TYPE_INDEX];
-    const ShapeType shapeType = getShapeType(typeFlag);
-    if (shapeType != INVALID_TYPE)
+    if (status == PARSE_ILLEGAL_SHAPE)
     {
-        // Parse the current line into coordinates and update the Points Vector.
-        parseCoordinates(currentLine, points);
-
-        // Create the proper Shape object.
-        pShape = shapeFactory(shapeType, points);
+        std::cerr << ILLEGAL_SHAPE_MESSAGE << getShapeName(shapeType) << std::endl;
     }
-    return pShape;
-
-}
-
-/**
- * @brief Update the given Shapes Vector with the given Shape Pointer to insert.
- *        If the given shape is invalid, the Vector will not be updated.
- * @param pShape A Shape Pointer to insert to the Shapes Vector.
- * @param shapes The Shapes Vector to update.
- * @return true if the Shape was inserted successfully, false otherwise.
- */
-static bool updateShapes(const ShapeP& pShape, ShapeVector& shapes)
-{
-    if (pShape != nullptr)
+    else if (status == PARSE_INVALID_FILE)
     {
-        if (pShape -> validateShape())
-        {
-            // Only valid Shapes can be inserted to the Shapes Vector.
-            shapes.push_back(pShape);
-            return true;
-        }
+        std::cerr << INVALID_BINARY_MESSAGE << std::endl;
+    }
+    else
+    {
+        std::cerr << INVALID_SHAPE_MESSAGE << std::endl;
     }
-    return false;
 }
 
 /**
@@ -254,57 +419,70 @@ static bool updateShapes(const ShapeP& pShape, ShapeVector& shapes)
  *        to the output stream.
  * @param currentLine The current line in the input stream with the data of the Shape.
  * @param shapes The Shapes Vector to update.
+ * @param arena The arena which holds the Shapes.
  * @return true if the Shape was created and inserted successfully, false otherwise.
  */
-static bool storeNewShape(std::string& currentLine, ShapeVector& shapes)
+static bool storeNewShape(const LineSpan& currentLine, ShapeVector& shapes, ShapeArena& arena)
 {
     // Create the current Shape from the given data in the line.
     ShapeP currentShape = nullptr;
-    currentShape = getShape(currentLine);
+    ShapeType shapeType = INVALID_TYPE;
+    ParseStatus status = parseShape(currentLine, currentShape, shapeType, &arena);
 
-    // Attempt to update the Shapes Vector with the new Shape if valid.
-    // If the Shape is invalid, the Vector won't be updated and the function will return false.
-    if (!updateShapes(currentShape, shapes))
+    // Only valid Shapes are inserted to the Shapes Vector. An invalid Shape is never returned by
+    // the parser, so there is nothing to delete here.
+    if (status != PARSE_SUCCESS)
     {
-        // The case of invalid Shape.
-        if (currentShape != nullptr)
-        {
-            // In this case, we still created a Shape but we didn't insert it in the Shapes Vector,
-            // so we need to delete it here.
-            std::cerr << ILLEGAL_SHAPE_MESSAGE << currentShape -> getType() << std::endl;
-            delete currentShape;
-        }
-        else
-        {
-            std::cerr << INVALID_SHAPE_MESSAGE << std::endl;
-        }
+        reportParseError(status, shapeType);
         return false;
     }
-
+    shapes.push_back(currentShape);
     return true;
 }
 
 /**
  * @brief Handles the input process.
- *        With the given input file stream, this function analyze the data to create all
+ *        With the given input file reader, this function analyze the data to create all
  *        the proper Shapes that declared in the input file and store them for later use.
- * @param inputFile The input file stream to read from.
+ *        A mapped input is parsed by several threads at once, where each thread parses a range of
+ *        whole lines. The Shapes and the reported error are the same as in a line by line parsing.
+ *        A mapped binary Shapes file is detected by it's magic value, and it's Shapes are loaded
+ *        without any parsing.
+ *        The Shapes are created in the given arena, so they are freed together at the end.
+ * @param inputFile The input file reader to read from.
  * @param shapes The Shapes Vector which holds all the Shapes declared in the input file.
+ * @param arena The arena which holds the Shapes.
  * @return true if the program ended successfully, false otherwise.
  */
-static bool handleInput(std::ifstream& inputFile, ShapeVector& shapes)
+static bool handleInput(InputReader& inputFile, ShapeVector& shapes, ShapeArena& arena)
 {
-    std::string currentLine;
-    while (std::getline(inputFile, currentLine))
+    LineSpan input;
+    if (inputFile.getMappedInput(input))
+    {
+        ShapeType shapeType = INVALID_TYPE;
+        ParseStatus status = isBinaryInput(input) ?
+                             loadBinaryShapes(input, getThreadCount(), shapes, shapeType, &arena) :
+                             parseShapesParallel(input, getThreadCount(), shapes, shapeType,
+                                                 &arena);
+        if (status != PARSE_SUCCESS)
+        {
+            reportParseError(status, shapeType);
+            return false;
+        }
+        return true;
+    }
+
+    LineSpan currentLine;
+    while (inputFile.nextLine(currentLine))
     {
         // We ignore empty lines in the file.
-        if (currentLine.empty())
+        if (currentLine.length == EMPTY_LINE_LENGTH)
         {
             continue;
         }
 
         // For each non-empty line in the file we create a Shape and store it in the Shapes Vector.
-        if (!storeNewShape(currentLine, shapes))
+        if (!storeNewShape(currentLine, shapes, arena))
         {
             return false;
         }
@@ -312,51 +490,175 @@ static bool handleInput(std::ifstream& inputFile, ShapeVector& shapes)
     return true;
 }
 
+/**
+ * @brief Read all the Points in the given Points file, one Point in a line, in their order.
+ *        Empty lines are ignored, and the reading stops at the first line which does not hold a
+ *        Point.
+ * @param pointsFile The Points file reader to read from.
+ * @param points The Vector which the Points are added to.
+ * @return true if all the lines hold Points, false otherwise.
+ */
+static bool readPoints(InputReader& pointsFile, std::vector<Point>& points)
+{
+    LineSpan currentLine;
+    while (pointsFile.nextLine(currentLine))
+    {
+        // We ignore empty lines in the file.
+        if (currentLine.length == EMPTY_LINE_LENGTH)
+        {
+            continue;
+        }
+
+        CordType x, y;
+        if (!parsePoint(currentLine, x, y))
+        {
+            std::cerr << ILLEGAL_POINT_MESSAGE << std::endl;
+            return false;
+        }
+        points.push_back(Point(x, y));
+    }
+    return true;
+}
+
+/**
+ * @brief Free all the Shapes in the given Shapes Vector that allocated by the ShapesFactory in
+ *        the given arena, and leave the Vector empty. The Shapes are freed at once with their
+ *        arena, which keeps only it's first block for the next Shapes.
+ * @param shapes The Shapes Vector which contains Shapes to free.
+ * @param arena The arena which holds the Shapes.
+ */
+static void releaseShapes(ShapeVector& shapes, ShapeArena& arena)
+{
+    shapes.clear();
+    arena.reset();
+}
+
+/**
+ * @brief Read all the Shapes in the input file in the given path into the given ShapeStore.
+ *        The Shapes are read the same way they are read for the analysis, and an error in the
+ *        file is reported the same way.
+ * @param path The path of the input file.
+ * @param store The ShapeStore which the Shapes are added to.
+ * @return true if the file was opened and all the Shapes were read, false otherwise.
+ */
+static bool readStore(const char *path, ShapeStore& store)
+{
+    ShapeArena arena;
+    ShapeVector shapes;
+    InputReader inputFile;
+    if (!openInput(inputFile, path))
+    {
+        reportStreamError(path);
+        return false;
+    }
+    if (!handleInput(inputFile, shapes, arena))
+    {
+        releaseShapes(shapes, arena);
+        return false;
+    }
+    store.append(shapes);
+    releaseShapes(shapes, arena);
+    return true;
+}
+
 
 /*-----=  Analyze Shapes Data  =-----*/
 
 
 /**
  * @brief Determine is there are Shapes that intersect with each other in our Shapes Container.
- *        If the function encountered an intersection, it will stop and report the first 2 Shapes
+ *        If the function encountered an intersection, it will report the first 2 Shapes
  *        that intersected, and return true.
- * @param shapes The Shapes Vector which holds the Shapes to check.
+ *        The Sweep Line compares only Shapes which share some range on the X axis. The Spatial
+ *        Grid compares only Shapes which share a cell, which suits dense inputs that are spread
+ *        evenly, and the R-Tree compares only Shapes which their Bounding Boxes overlap, which
+ *        suits uneven inputs. The Spatial Grid and the R-Tree use all the worker threads.
+ *        All the engines report the same pair.
+ * @param shapes The ShapeStore which holds the Shapes to check.
+ * @param engine The engine which finds the intersection.
  * @return true if there is at least one intersection, false otherwise.
  */
-static bool checkIntersection(const ShapeVector& shapes)
+static bool checkIntersection(const ShapeStore& shapes, IntersectionEngine const engine)
 {
-    // We compare each Shape in the Shapes Vector with all the other Shapes in the Vector.
-    for (auto i = shapes.begin(); i != shapes.end(); i++)
+    ShapeIndex first, second;
+    bool found = false;
+    switch (engine)
     {
-        for (auto j = i + 1; j != shapes.end(); j++)
+        case GRID_ENGINE:
         {
-            // For each 2 Shapes, we check either one is a Sub-Set of the other, or that they
-            // have some edges that intersect with each other.
-            if ((*i) -> intersectWith(**j) || (*i) -> subsetOf(**j))
-            {
-                // We output only our first encounter of intersection.
-                (*i) -> printShape();
-                (*j) -> printShape();
-                return true;
-            }
+            SpatialGrid grid(SpatialGrid::chooseCellSize(shapes), shapes.size());
+            grid.build(shapes);
+            found = grid.findFirstIntersection(shapes, first, second);
+            break;
         }
+
+        case RTREE_ENGINE:
+        {
+            RTree tree;
+            tree.build(shapes);
+            found = tree.findFirstIntersection(shapes, first, second);
+            break;
+        }
+
+        default:
+            found = findFirstIntersection(shapes, first, second);
+    }
+
+    if (found)
+    {
+        // We output only our first encounter of intersection.
+        shapes.printShape(first);
+        shapes.printShape(second);
+        return true;
     }
     return false;
 }
 
+
 /**
- * @brief Calculate the total area of all the Shapes in the given Shapes Vector.
- * @param shapes The Shapes Vector which holds the Shapes to calculate their area.
- * @return the sum of all the Shapes' area.
+ * @brief Report every pair of intersecting Shapes, one pair in a line, sorted by the first
+ *        Shape and then by the second Shape. A Shape is reported by it's number in the input,
+ *        starting from 1. The pairs are found by the R-Tree on all the worker threads, and are
+ *        written through a buffer.
+ * @param shapes The ShapeStore which holds the Shapes to check.
  */
-static CordType getTotalArea(const ShapeVector& shapes)
+static void reportAllPairs(const ShapeStore& shapes)
 {
-    CordType result = EMPTY_SHAPE_SIZE;
-    for (auto i = shapes.begin(); i != shapes.end(); i++)
+    RTree tree;
+    tree.build(shapes);
+    PairVector pairs;
+    tree.findAllIntersections(shapes, pairs);
+
+    OutputBuffer output(std::cout);
+    for (auto i = pairs.begin(); i != pairs.end(); i++)
     {
-        result += (*i) -> getArea();
+        output.writeIndex(i -> first + FIRST_SHAPE_NUMBER);
+        output.write(PAIR_SEPARATOR);
+        output.writeIndex(i -> second + FIRST_SHAPE_NUMBER);
+        output.write(PAIR_END);
     }
-    return result;
+}
+
+/**
+ * @brief Report the amount of pairs of intersecting Shapes, without keeping the pairs.
+ *        The pairs are counted by the R-Tree on all the worker threads.
+ * @param shapes The ShapeStore which holds the Shapes to check.
+ */
+static void reportPairCount(const ShapeStore& shapes)
+{
+    RTree tree;
+    tree.build(shapes);
+    std::cout << tree.countIntersections(shapes) << std::endl;
+}
+
+/**
+ * @brief Report the area of the union of the Shapes, i.e. the area which is covered by at least
+ *        one Shape, where an area which several Shapes cover is counted once.
+ * @param shapes The ShapeStore which holds the Shapes.
+ */
+static void reportUnionArea(const ShapeStore& shapes)
+{
+    std::cout << UNION_AREA_MESSAGE << calculateUnionArea(shapes) << std::endl;
 }
 
 
@@ -364,65 +666,439 @@ static CordType getTotalArea(const ShapeVector& shapes)
 
 
 /**
- * @brief Handles the output of the program according to the analysis of the given Shapes Vector.
+ * @brief Handles the output of the program according to the analysis of the given ShapeStore.
  *        In case of an intersection, the program reports the intersection of the 2 Shapes,
  *        otherwise it just states the total area of all the Shapes.
- * @param shapes The Shapes Vector to analyze.
+ *        With the '--all-pairs' option every pair of intersecting Shapes is reported instead,
+ *        and with the '--count' option the amount of these pairs is reported. With the
+ *        '--union-area' option the area of the union of the Shapes is reported.
+ * @param shapes The ShapeStore to analyze.
+ * @param options The options that were given to the program.
  */
-static void handleOutput(const ShapeVector& shapes)
+static void handleOutput(const ShapeStore& shapes, const Options& options)
 {
-    if (checkIntersection(shapes))
+    if (options.report == ALL_PAIRS_REPORT)
+    {
+        reportAllPairs(shapes);
+    }
+    else if (options.report == COUNT_REPORT)
+    {
+        reportPairCount(shapes);
+    }
+    else if (options.report == UNION_AREA_REPORT)
+    {
+        reportUnionArea(shapes);
+    }
+    else if (checkIntersection(shapes, options.engine))
     {
         reportDrawIntersect();
     }
     else
     {
-        CordType totalArea = getTotalArea(shapes);
+        CordType totalArea = shapes.getTotalArea();
         printArea(totalArea);
     }
 }
 
+/**
+ * @brief Handles the input and the output together, without waiting for the whole input.
+ *        Every Shape is checked against the Shapes before it as soon as it is read, and the
+ *        program stops reading at the first intersection. The reported pair is the pair with the
+ *        smallest second index, and among those the pair with the smallest first index, so it
+ *        may differ from the pair that is reported after the whole input is read.
+ *        If there is no intersection, the total area of all the Shapes is reported.
+ * @param inputFile The input file reader to read from.
+ * @param shapes The Shapes Vector which holds the Shape that is currently read.
+ * @param arena The arena which holds the Shape that is currently read.
+ * @return true if the program ended successfully, false otherwise.
+ */
+static bool handleStream(InputReader& inputFile, ShapeVector& shapes, ShapeArena& arena)
+{
+    ShapeStore store;
+    StreamChecker checker;
+    LineSpan currentLine;
+    while (inputFile.nextLine(currentLine))
+    {
+        // We ignore empty lines in the file.
+        if (currentLine.length == EMPTY_LINE_LENGTH)
+        {
+            continue;
+        }
+        if (!storeNewShape(currentLine, shapes, arena))
+        {
+            return false;
+        }
+        store.append(*shapes.back());
+        releaseShapes(shapes, arena);
+
+        ShapeIndex first;
+        if (checker.addShape(store, first))
+        {
+            store.printShape(first);
+            store.printShape(store.size() - 1);
+            reportDrawIntersect();
+            return true;
+        }
+    }
+
+    CordType totalArea = store.getTotalArea();
+    printArea(totalArea);
+    return true;
+}
+
 /**
  * @brief Frees all the resources and revert all changes that has been done during the run of
  *        the program.
  *        The function free all the resources from the given Shapes Vector, and assign back the
  *        original output stream.
  * @param shapes The Shapes Vector which contains Shapes to free.
+ * @param arena The arena which holds the Shapes.
  * @param originalStream The original output stream.
  */
-static void freeResources(ShapeVector& shapes, std::streambuf *originalStream)
+static void freeResources(ShapeVector& shapes, ShapeArena& arena, std::streambuf *originalStream)
 {
     // Free all the memory in the Shapes Vector that allocated by the ShapesFactory.
-    for (auto i = shapes.begin(); i != shapes.end(); i++)
-    {
-        delete *i;
-    }
+    releaseShapes(shapes, arena);
 
     // Return the output stream back to normal.
     std::cout.rdbuf(originalStream);
 }
 
 
+/**
+ * @brief Convert the input file in the given arguments to a binary Shapes file in the output
+ *        path in the given arguments. The input file is read the same way it is read for the
+ *        analysis, so a text file and a binary file are both converted.
+ * @param argc The number of given arguments, without the options.
+ * @param argv The arguments from the user, without the options.
+ * @return 0 if the file was converted successfully, -1 otherwise.
+ */
+static int convertInput(int argc, char *argv[])
+{
+    if (argc != INPUT_OUTPUT_ARGUMENTS_SIZE)
+    {
+        // The conversion requires both the input file and the output file.
+        std::cerr << INVALID_ARGUMENTS_MESSAGE << std::endl;
+        return INVALID_STATE;
+    }
+
+    ShapeArena arena;
+    ShapeVector shapes;
+    InputReader inputFile;
+    std::streambuf *originalStream = std::cout.rdbuf();
+    if (!openInput(inputFile, argv[INPUT_FILE_INDEX]))
+    {
+        reportStreamError(argv[INPUT_FILE_INDEX]);
+        return INVALID_STATE;
+    }
+    if (!handleInput(inputFile, shapes, arena))
+    {
+        freeResources(shapes, arena, originalStream);
+        return INVALID_STATE;
+    }
+    if (!writeBinaryShapes(shapes, argv[OUTPUT_FILE_INDEX]))
+    {
+        reportStreamError(argv[OUTPUT_FILE_INDEX]);
+        freeResources(shapes, arena, originalStream);
+        return INVALID_STATE;
+    }
+    freeResources(shapes, arena, originalStream);
+    return VALID_STATE;
+}
+
+/**
+ * @brief Run the Shapes service on the Unix socket in the path in the given arguments, until a
+ *        client stops it. The Shapes of an optional input file in the given arguments are added
+ *        to the service first, in their order.
+ * @param argc The number of given arguments, without the options.
+ * @param argv The arguments from the user, without the options.
+ * @return 0 if the service was stopped by a client, -1 otherwise.
+ */
+static int serveShapes(int argc, char *argv[])
+{
+    if (argc != INPUT_ONLY_ARGUMENTS_SIZE && argc != INPUT_OUTPUT_ARGUMENTS_SIZE)
+    {
+        std::cerr << INVALID_ARGUMENTS_MESSAGE << std::endl;
+        return INVALID_STATE;
+    }
+
+    ShapeService service;
+    if (argc == INPUT_OUTPUT_ARGUMENTS_SIZE)
+    {
+        ShapeArena arena;
+        ShapeVector shapes;
+        InputReader inputFile;
+        if (!openInput(inputFile, argv[SCENE_FILE_INDEX]))
+        {
+            reportStreamError(argv[SCENE_FILE_INDEX]);
+            return INVALID_STATE;
+        }
+        if (!handleInput(inputFile, shapes, arena))
+        {
+            releaseShapes(shapes, arena);
+            return INVALID_STATE;
+        }
+
+        // The intersections inside the input file are not reported, only later ones.
+        std::vector<ShapeIndex> overlaps;
+        for (auto i = shapes.begin(); i != shapes.end(); i++)
+        {
+            overlaps.clear();
+            service.addShape(**i, overlaps);
+        }
+        releaseShapes(shapes, arena);
+    }
+
+    if (!service.serve(argv[SOCKET_PATH_INDEX]))
+    {
+        reportStreamError(argv[SOCKET_PATH_INDEX]);
+        return INVALID_STATE;
+    }
+    return VALID_STATE;
+}
+
+/**
+ * @brief Find the Shape which contains every Point in the Points file in the given arguments,
+ *        among the Shapes of the input file in the given arguments. The number of the Shape of
+ *        every Point is reported in a line, in the order of the Points, where a Point which no
+ *        Shape contains is reported as 0. If several Shapes contain a Point, the first of them
+ *        is reported. The Points are located by a slab decomposition of the Shapes on all the
+ *        worker threads.
+ * @param argc The number of given arguments, without the options.
+ * @param argv The arguments from the user, without the options.
+ * @return 0 if all the Points were located, -1 otherwise.
+ */
+static int locatePoints(int argc, char *argv[])
+{
+    if (argc != INPUT_OUTPUT_ARGUMENTS_SIZE)
+    {
+        // The location requires both the input file and the Points file.
+        std::cerr << INVALID_ARGUMENTS_MESSAGE << std::endl;
+        return INVALID_STATE;
+    }
+
+    ShapeStore store;
+    if (!readStore(argv[INPUT_FILE_INDEX], store))
+    {
+        return INVALID_STATE;
+    }
+
+    std::vector<Point> points;
+    InputReader pointsFile;
+    if (!openInput(pointsFile, argv[POINTS_FILE_INDEX]))
+    {
+        reportStreamError(argv[POINTS_FILE_INDEX]);
+        return INVALID_STATE;
+    }
+    if (!readPoints(pointsFile, points))
+    {
+        return INVALID_STATE;
+    }
+
+    PointLocator locator;
+    locator.build(store);
+    std::vector<ShapeIndex> located;
+    locator.locateAll(store, points, located);
+
+    OutputBuffer output(std::cout);
+    for (auto i = located.begin(); i != located.end(); i++)
+    {
+        output.writeIndex(*i == NO_SHAPE ? NO_SHAPE_NUMBER : *i + FIRST_SHAPE_NUMBER);
+        output.write(PAIR_END);
+    }
+    return VALID_STATE;
+}
+
+/**
+ * @brief Report every pair of intersecting Shapes where the first Shape is from the first input
+ *        file in the given arguments and the second Shape is from the second input file, one
+ *        pair in a line, sorted by the first Shape and then by the second Shape. Every Shape is
+ *        reported by it's number in it's own file, starting from 1, and two Shapes of the same
+ *        file are never checked. The pairs are found by a partition based spatial join of the
+ *        two files on all the worker threads.
+ * @param argc The number of given arguments, without the options.
+ * @param argv The arguments from the user, without the options.
+ * @return 0 if both files were read successfully, -1 otherwise.
+ */
+static int joinInputs(int argc, char *argv[])
+{
+    if (argc != INPUT_OUTPUT_ARGUMENTS_SIZE)
+    {
+        // The join requires both input files.
+        std::cerr << INVALID_ARGUMENTS_MESSAGE << std::endl;
+        return INVALID_STATE;
+    }
+
+    ShapeStore first;
+    ShapeStore second;
+    if (!readStore(argv[INPUT_FILE_INDEX], first) ||
+        !readStore(argv[SECOND_INPUT_FILE_INDEX], second))
+    {
+        return INVALID_STATE;
+    }
+
+    PairVector pairs;
+    joinShapes(first, second, pairs);
+
+    OutputBuffer output(std::cout);
+    for (auto i = pairs.begin(); i != pairs.end(); i++)
+    {
+        output.writeIndex(i -> first + FIRST_SHAPE_NUMBER);
+        output.write(PAIR_SEPARATOR);
+        output.writeIndex(i -> second + FIRST_SHAPE_NUMBER);
+        output.write(PAIR_END);
+    }
+    return VALID_STATE;
+}
+
+
+/*-----=  Arguments Handling  =-----*/
+
+
+/**
+ * @brief Returns the engine which finds the intersection when no engine option is given.
+ *        The Sweep Line runs on a single thread, so it is the default on a single core, and the
+ *        R-Tree, which runs on all the worker threads, is the default on several cores. Both
+ *        engines report the same pair, so only the running time depends on the choice.
+ * @return The default engine.
+ */
+static IntersectionEngine getDefaultEngine()
+{
+    return getThreadCount() > 1 ? RTREE_ENGINE : SWEEP_ENGINE;
+}
+
+/**
+ * @brief Handles the options that appear in the given arguments before the files.
+ *        Every handled option is removed from the arguments, so the files are found afterwards
+ *        in their usual indices. Every mode option, i.e. '--convert', '--stream', '--serve',
+ *        '--locate' or '--join', replaces the usual analysis, so it can not be given with another
+ *        mode option or with the '--all-pairs', the '--count' or the '--union-area' options.
+ * @param argc The number of given arguments.
+ * @param argv The arguments from the user.
+ * @param options The Options to update.
+ * @return true if all the options are valid, false otherwise.
+ */
+static bool handleOptions(int& argc, char **& argv, Options& options)
+{
+    options.engine = getDefaultEngine();
+    options.report = FIRST_PAIR_REPORT;
+    options.convert = false;
+    options.stream = false;
+    options.serve = false;
+    options.locate = false;
+    options.join = false;
+
+    std::string prefix = OPTION_PREFIX;
+    while (argc > INPUT_FILE_INDEX &&
+           std::string(argv[INPUT_FILE_INDEX]).compare(START_INDEX, prefix.size(), prefix) == 0)
+    {
+        std::string option = argv[INPUT_FILE_INDEX];
+        if (option == SWEEP_OPTION)
+        {
+            options.engine = SWEEP_ENGINE;
+        }
+        else if (option == GRID_OPTION)
+        {
+            options.engine = GRID_ENGINE;
+        }
+        else if (option == RTREE_OPTION)
+        {
+            options.engine = RTREE_ENGINE;
+        }
+        else if (option == STREAM_OPTION)
+        {
+            options.stream = true;
+        }
+        else if (option == CONVERT_OPTION)
+        {
+            options.convert = true;
+        }
+        else if (option == SERVE_OPTION)
+        {
+            options.serve = true;
+        }
+        else if (option == LOCATE_OPTION)
+        {
+            options.locate = true;
+        }
+        else if (option == JOIN_OPTION)
+        {
+            options.join = true;
+        }
+        else if (option == ALL_PAIRS_OPTION)
+        {
+            options.report = ALL_PAIRS_REPORT;
+        }
+        else if (option == COUNT_OPTION)
+        {
+            options.report = COUNT_REPORT;
+        }
+        else if (option == UNION_AREA_OPTION)
+        {
+            options.report = UNION_AREA_REPORT;
+        }
+        else
+        {
+            return false;
+        }
+
+        // Remove the option while keeping the program name first.
+        argv[INPUT_FILE_INDEX] = argv[START_INDEX];
+        argv++;
+        argc--;
+    }
+
+    // A mode reports it's own result, so it can not be combined with another report.
+    int modes = (int) options.convert + (int) options.stream + (int) options.serve +
+                (int) options.locate + (int) options.join;
+    return modes < MAX_MODES || (modes == MAX_MODES && options.report == FIRST_PAIR_REPORT);
+}
+
+
 /*-----=  Main  =-----*/
 
 
 /**
  * @brief The main function that runs the program.
  *        The function receives 1-2 arguments, which determine the input stream and
- *        the output stream. The output stream is optional, and if not specified the output stream
+ *        the output stream. The arguments may start with options, e.g. '--sweep', '--grid' or
+ *        '--rtree' which find the intersection using the Sweep Line, the Spatial Grid or the
+ *        R-Tree. By default the Sweep Line is used on a single core, and the R-Tree is used on
+ *        several cores. The output stream is optional, and if not specified the output stream
  *        will be the standard output stream.
+ *        With the '--convert' option, the input file is converted to a binary Shapes file in the
+ *        output path instead, and nothing is analyzed. With the '--stream' option, every Shape
+ *        is checked as soon as it is read, and the input path '-' reads the standard input.
+ *        The stream reports the intersecting pair with the smallest second index, which is
+ *        known as soon as that Shape is read, instead of the pair with the smallest first index.
+ *        With the '--all-pairs' option every pair of intersecting Shapes is reported, and with
+ *        the '--count' option only the amount of these pairs is reported. With the
+ *        '--union-area' option the area of the union of the Shapes is reported, where an area
+ *        which several Shapes cover is counted once.
+ *        With the '--serve' option the first argument is the path of a Unix socket, where the
+ *        Shapes service answers commands, and the optional second argument is an input file
+ *        which the service starts with. With the '--locate' option the second argument is a
+ *        Points file, and the number of the Shape which contains every Point is reported.
+ *        With the '--join' option the second argument is another input file, and every pair of
+ *        intersecting Shapes where one Shape is from every file is reported.
+ *        At most one of the '--convert', '--stream', '--serve', '--locate' and '--join' options
+ *        can be given, and none of them with the '--all-pairs', '--count' or '--union-area'
+ *        options.
  *        Then the function analyze the input data, and process it to determine if there is an
  *        intersection between the given shapes.
  *        The function report to the output stream the result of the process.
  *        Note that all the File Streams are closed with the call of their Destructor.
+ *        The input file is read through an InputReader, which maps a regular file to memory.
  * @param argc The number of given arguments.
  * @param argv[] The arguments from the user.
  * @return 0 if the program ended successfully, -1 otherwise.
  */
 int main(int argc, char *argv[])
 {
+    ShapeArena arena;
     ShapeVector shapes;
-    std::ifstream inputFile;
+    Options options;
+    InputReader inputFile;
     std::ofstream outputFile;
     std::streambuf *originalStream = std::cout.rdbuf();
 
@@ -431,6 +1107,29 @@ int main(int argc, char *argv[])
     std::cout << std::setprecision(DECIMAL_POINT_PRECISION);
 
     // Handle Arguments.
+    if (!handleOptions(argc, argv, options))
+    {
+        // In this case we received an unknown option, or options which can not be combined.
+        std::cerr << INVALID_ARGUMENTS_MESSAGE << std::endl;
+        std::cerr << OPTIONS_USAGE_MESSAGE << std::endl;
+        return INVALID_STATE;
+    }
+    if (options.convert)
+    {
+        return convertInput(argc, argv);
+    }
+    if (options.serve)
+    {
+        return serveShapes(argc, argv);
+    }
+    if (options.locate)
+    {
+        return locatePoints(argc, argv);
+    }
+    if (options.join)
+    {
+        return joinInputs(argc, argv);
+    }
     if (argc == INPUT_OUTPUT_ARGUMENTS_SIZE)
     {
         // In this case we received an input file to read from, and and output file to write to.
@@ -451,23 +1150,32 @@ int main(int argc, char *argv[])
     }
 
     // In this case we handle the input file stream.
-    inputFile.open(argv[INPUT_FILE_INDEX]);
-    if (!inputFile)
+    if (!openInput(inputFile, argv[INPUT_FILE_INDEX]))
     {
         // If the given input file is an invalid file.
         reportStreamError(argv[INPUT_FILE_INDEX]);
-        freeResources(shapes, originalStream);
+        freeResources(shapes, arena, originalStream);
         return INVALID_STATE;
     }
 
     // Analyze Data.
-    if (handleInput(inputFile, shapes))
+    if (options.stream)
+    {
+        bool valid = handleStream(inputFile, shapes, arena);
+        freeResources(shapes, arena, originalStream);
+        return valid ? VALID_STATE : INVALID_STATE;
+    }
+    if (handleInput(inputFile, shapes, arena))
     {
-        handleOutput(shapes);
-        freeResources(shapes, originalStream);
+        // The analysis runs on the columns of a ShapeStore, so the Shapes are not needed anymore.
+        ShapeStore store;
+        store.append(shapes);
+        releaseShapes(shapes, arena);
+        handleOutput(store, options);
+        freeResources(shapes, arena, originalStream);
         return VALID_STATE;
     }
-    freeResources(shapes, originalStream);
+    freeResources(shapes, arena, originalStream);
     return INVALID_STATE;
 }
 
@@ -0,0 +1,874 @@
+/**
+ * @file SpatialGrid.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A File for the SpatialGrid Class implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the SpatialGrid Class implementation.
+ * Define the SpatialGrid Class, it's methods and fields.
+ * A SpatialGrid class divides the plane into square cells, and holds for each cell the Shapes
+ * which their Bounding Box covers it. The grid has several levels, where the cells of every level
+ * are larger than the cells of the level below it, and every Shape is kept in the lowest level
+ * where it covers only a few cells, so a large Shape never fills the grid. The cells are stored in
+ * a hash table, so only cells which contain Shapes take memory. Shapes of the same level can only
+ * intersect if they share a cell, and a Shape is checked against the higher levels through the
+ * few cells it covers in each of them. A Shape which is too large even for the highest level is
+ * kept in a separate list of oversized Shapes, which is checked against all the other Shapes.
+ * Several worker threads can insert Shapes to the grid at the same time without any lock.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "SpatialGrid.h"
+#include "SweepLine.h"
+#include "Parallel.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def NO_ENTRY ((EntryIndex) -1)
+ * @brief A Macro that sets the value of an empty link between entries.
+ */
+#define NO_ENTRY ((EntryIndex) -1)
+
+/**
+ * @def FIRST_BLOCK_SIZE 1024
+ * @brief A Macro that sets the amount of entries in the first block of entries.
+ */
+#define FIRST_BLOCK_SIZE 1024
+
+/**
+ * @def MIN_BUCKETS 1024
+ * @brief A Macro that sets the smallest amount of buckets in the hash table.
+ */
+#define MIN_BUCKETS 1024
+
+/**
+ * @def MAX_CELLS_PER_AXIS 4096
+ * @brief A Macro that sets the largest amount of cells along one axis of the extent of the
+ *        Shapes. It prevents very small Shapes in a large extent from creating tiny cells.
+ */
+#define MAX_CELLS_PER_AXIS 4096
+
+/**
+ * @def MAX_CELLS_PER_SHAPE 64
+ * @brief A Macro that sets the largest amount of cells which a single Shape is inserted to.
+ *        A Shape which covers more cells is kept in a higher level.
+ */
+#define MAX_CELLS_PER_SHAPE 64
+
+/**
+ * @def LEVEL_GROWTH 8
+ * @brief A Macro that sets the factor which the size of the cells grows by from one level of the
+ *        grid to the next.
+ */
+#define LEVEL_GROWTH 8
+
+/**
+ * @def OVERSIZED_CELL (CELL_LIMIT + 1)
+ * @brief A Macro that sets the cell coordinates of the entry of an oversized Shape, which is
+ *        outside every cell of the grid.
+ */
+#define OVERSIZED_CELL (CELL_LIMIT + 1)
+
+/**
+ * @def CELL_VISIT_COST 16
+ * @brief A Macro that sets how many entries can be scanned one after the other in the time that
+ *        a single cell is visited through the hash table.
+ */
+#define CELL_VISIT_COST 16
+
+/**
+ * @def CELL_LIMIT 1099511627776LL
+ * @brief A Macro that sets the largest cell coordinate in absolute value. Values which are
+ *        further from the origin belong to the cells on the edge of the grid.
+ */
+#define CELL_LIMIT 1099511627776LL
+
+/**
+ * @def DEFAULT_CELL_SIZE 1
+ * @brief A Macro that sets the size of the cells when the Shapes give no information about it.
+ */
+#define DEFAULT_CELL_SIZE 1
+
+/**
+ * @def HASH_PRIME_X 73856093ULL
+ * @brief A Macro that sets the prime that the X coordinate of a cell is multiplied by in the hash.
+ */
+#define HASH_PRIME_X 73856093ULL
+
+/**
+ * @def HASH_PRIME_Y 19349663ULL
+ * @brief A Macro that sets the prime that the Y coordinate of a cell is multiplied by in the hash.
+ */
+#define HASH_PRIME_Y 19349663ULL
+
+/**
+ * @def HASH_PRIME_LEVEL 83492791ULL
+ * @brief A Macro that sets the prime that the level of a cell is multiplied by in the hash.
+ */
+#define HASH_PRIME_LEVEL 83492791ULL
+
+/**
+ * @def HALF 0.5
+ * @brief A Macro that sets the factor which averages the width and height of a Shape.
+ */
+#define HALF 0.5
+
+/**
+ * @def QUARTER 0.25
+ * @brief A Macro that sets the position of the lower quartile in the sorted sizes of the Shapes.
+ */
+#define QUARTER 0.25
+
+
+/*-----=  SpatialGrid Constructors & Destructors  =-----*/
+
+
+/**
+ * @brief A Constructor for the SpatialGrid.
+ * @param cellSize The length of the edge of every cell in the lowest level of the grid.
+ * @param expectedEntries The amount of entries the grid is expected to hold, which determines
+ *        the size of the hash table.
+ */
+SpatialGrid::SpatialGrid(CordType const cellSize, size_t const expectedEntries)
+        : _entryCount(0), _oversized(NO_ENTRY), _oversizedCount(0), _usedLevels(0)
+{
+    _cellSizes[0] = cellSize > 0 ? cellSize : DEFAULT_CELL_SIZE;
+    for (int level = 0; level < GRID_LEVELS; level++)
+    {
+        if (level > 0)
+        {
+            _cellSizes[level] = _cellSizes[level - 1] * LEVEL_GROWTH;
+        }
+        _levelMinX[level].store(std::numeric_limits<CordType>::infinity());
+        _levelMaxX[level].store(-std::numeric_limits<CordType>::infinity());
+        _levelMinY[level].store(std::numeric_limits<CordType>::infinity());
+        _levelMaxY[level].store(-std::numeric_limits<CordType>::infinity());
+    }
+
+    // The amount of buckets is a power of 2 so a bucket can be chosen with a mask.
+    size_t bucketCount = MIN_BUCKETS;
+    while (bucketCount < expectedEntries)
+    {
+        bucketCount *= 2;
+    }
+    _buckets = std::vector<std::atomic<EntryIndex>>(bucketCount);
+    for (auto i = _buckets.begin(); i != _buckets.end(); i++)
+    {
+        i -> store(NO_ENTRY, std::memory_order_relaxed);
+    }
+    for (int i = 0; i < GRID_BLOCKS; i++)
+    {
+        _blocks[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief The Destructor for the SpatialGrid Class.
+ */
+SpatialGrid::~SpatialGrid()
+{
+    for (int i = 0; i < GRID_BLOCKS; i++)
+    {
+        delete[] _blocks[i].load(std::memory_order_relaxed);
+    }
+}
+
+
+/*-----=  SpatialGrid Helpers  =-----*/
+
+
+/**
+ * @brief Choose the size of the cells in the lowest level for the given Shapes, according to
+ *        the extent of all the Shapes and the size of the smaller Shapes, so large Shapes do not
+ *        change it.
+ * @param shapes The Shapes that the grid will hold.
+ * @return The length of the edge of every cell in the lowest level of the grid.
+ */
+CordType SpatialGrid::chooseCellSize(const ShapeStore& shapes)
+{
+    // Only Shapes with a finite size tell something about the size of the cells.
+    BoundingBox extent;
+    std::vector<CordType> sizes;
+    sizes.reserve(shapes.size());
+    for (ShapeIndex i = 0; i < shapes.size(); i++)
+    {
+        const BoundingBox& box = shapes.getBoundingBox(i);
+        CordType size = HALF * ((box.getMaxX() - box.getMinX()) + (box.getMaxY() - box.getMinY()));
+        if (std::isfinite(size))
+        {
+            extent.expand(box);
+            sizes.push_back(size);
+        }
+    }
+    if (sizes.empty())
+    {
+        return DEFAULT_CELL_SIZE;
+    }
+
+    // A cell of the size of the lower quartile keeps the smaller Shapes in a few cells each, as
+    // long as they are not tiny compared to the extent of the whole input. The larger Shapes are
+    // kept in the higher levels, so they do not crowd the cells of the smaller ones.
+    auto quartile = sizes.begin() + (size_t) (sizes.size() * QUARTER);
+    std::nth_element(sizes.begin(), quartile, sizes.end());
+    CordType extentSize = std::max(extent.getMaxX() - extent.getMinX(),
+                                   extent.getMaxY() - extent.getMinY());
+    CordType cellSize = std::max(*quartile, extentSize / MAX_CELLS_PER_AXIS);
+    return std::isfinite(cellSize) && cellSize > 0 ? cellSize : DEFAULT_CELL_SIZE;
+}
+
+/**
+ * @brief Returns the coordinate of the cell which contains the given value on some axis.
+ * @param value The value on the axis.
+ * @param level The level of the grid.
+ * @return The coordinate of the cell.
+ */
+CellCord SpatialGrid::_getCell(CordType const value, int const level) const
+{
+    CordType cell = std::floor(value / _cellSizes[level]);
+    if (cell > CELL_LIMIT)
+    {
+        return CELL_LIMIT;
+    }
+    if (cell < -CELL_LIMIT)
+    {
+        return -CELL_LIMIT;
+    }
+    return (CellCord) cell;
+}
+
+/**
+ * @brief Determine if the given range of cells has more cells than the given limit.
+ * @param minCellX The X coordinate of the first cell in the range.
+ * @param maxCellX The X coordinate of the last cell in the range.
+ * @param minCellY The Y coordinate of the first cell in the range.
+ * @param maxCellY The Y coordinate of the last cell in the range.
+ * @param limit The largest amount of cells.
+ * @return true if the range has more cells than the limit, false otherwise.
+ */
+static bool hasMoreCells(CellCord const minCellX, CellCord const maxCellX,
+                         CellCord const minCellY, CellCord const maxCellY, CellCord const limit)
+{
+    // Every span is checked first, so their product can not overflow.
+    CellCord spanX = maxCellX - minCellX + 1;
+    CellCord spanY = maxCellY - minCellY + 1;
+    return spanX > limit || spanY > limit || spanX * spanY > limit;
+}
+
+/**
+ * @brief Returns the bucket in the hash table which holds the given cell.
+ * @param cellX The X coordinate of the cell.
+ * @param cellY The Y coordinate of the cell.
+ * @param level The level of the grid which the cell belongs to.
+ * @return The index of the bucket in the hash table.
+ */
+size_t SpatialGrid::_getBucket(CellCord const cellX, CellCord const cellY, int const level) const
+{
+    unsigned long long hash = ((unsigned long long) cellX * HASH_PRIME_X) ^
+                              ((unsigned long long) cellY * HASH_PRIME_Y) ^
+                              ((unsigned long long) level * HASH_PRIME_LEVEL);
+    return (size_t) (hash & (_buckets.size() - 1));
+}
+
+/**
+ * @brief Find the cells of the given level which the given Bounding Box covers inside the extent
+ *        of the Shapes of this level, since the cells outside it are all empty.
+ * @param box The Bounding Box to find the cells of.
+ * @param level The level of the grid.
+ * @param minCellX The X coordinate of the first cell.
+ * @param maxCellX The X coordinate of the last cell.
+ * @param minCellY The Y coordinate of the first cell.
+ * @param maxCellY The Y coordinate of the last cell.
+ * @return true if the Bounding Box covers a part of the extent, false otherwise.
+ */
+bool SpatialGrid::_getLevelCells(const BoundingBox& box, int const level, CellCord& minCellX,
+                                 CellCord& maxCellX, CellCord& minCellY, CellCord& maxCellY) const
+{
+    CordType minX = std::max(box.getMinX(), _levelMinX[level].load(std::memory_order_relaxed));
+    CordType maxX = std::min(box.getMaxX(), _levelMaxX[level].load(std::memory_order_relaxed));
+    CordType minY = std::max(box.getMinY(), _levelMinY[level].load(std::memory_order_relaxed));
+    CordType maxY = std::min(box.getMaxY(), _levelMaxY[level].load(std::memory_order_relaxed));
+    if (!(minX <= maxX && minY <= maxY))
+    {
+        return false;
+    }
+    minCellX = _getCell(minX, level);
+    maxCellX = _getCell(maxX, level);
+    minCellY = _getCell(minY, level);
+    maxCellY = _getCell(maxY, level);
+    return true;
+}
+
+/**
+ * @brief Determine if the given entry is in the lowest cell of it's Shape, which is the entry
+ *        that represents the Shape when every Shape should be found once.
+ * @param entry The entry of a Shape in a cell.
+ * @return true if the entry is in the lowest cell of it's Shape, false otherwise.
+ */
+bool SpatialGrid::_isLowestCell(const GridEntry& entry) const
+{
+    return entry.cellX == _getCell(entry.box.getMinX(), entry.level) &&
+           entry.cellY == _getCell(entry.box.getMinY(), entry.level);
+}
+
+/**
+ * @brief Returns the block which holds the entry in the given position, and the position of the
+ *        entry inside the block.
+ * @param index The position of the entry.
+ * @param offset The position of the entry inside the block.
+ * @return The number of the block.
+ */
+static int getBlock(EntryIndex const index, EntryIndex& offset)
+{
+    // Block number b holds FIRST_BLOCK_SIZE * 2^b entries, starting after all the entries of
+    // the blocks before it.
+    unsigned long long position = index / FIRST_BLOCK_SIZE + 1;
+    int block = 63 - __builtin_clzll(position);
+    offset = index - (EntryIndex) FIRST_BLOCK_SIZE * ((1ULL << block) - 1);
+    return block;
+}
+
+/**
+ * @brief Returns the entry in the given position, allocating it's block if needed.
+ *        This method is lock free.
+ * @param index The position of the entry.
+ * @return A reference to the entry.
+ */
+GridEntry& SpatialGrid::_getEntry(EntryIndex const index)
+{
+    EntryIndex offset;
+    int block = getBlock(index, offset);
+
+    GridEntry *entries = _blocks[block].load(std::memory_order_acquire);
+    if (entries == nullptr)
+    {
+        // The first thread which needs the block allocates it. If another thread was faster,
+        // we use it's block and throw ours.
+        GridEntry *allocated = new GridEntry[(EntryIndex) FIRST_BLOCK_SIZE << block];
+        if (_blocks[block].compare_exchange_strong(entries, allocated, std::memory_order_acq_rel))
+        {
+            entries = allocated;
+        }
+        else
+        {
+            delete[] allocated;
+        }
+    }
+    return entries[offset];
+}
+
+/**
+ * @brief Returns the entry in the given position.
+ * @param index The position of the entry.
+ * @return A reference to the entry.
+ */
+const GridEntry& SpatialGrid::_getEntry(EntryIndex const index) const
+{
+    EntryIndex offset;
+    int block = getBlock(index, offset);
+    return _blocks[block].load(std::memory_order_acquire)[offset];
+}
+
+
+/*-----=  SpatialGrid Insertion  =-----*/
+
+
+/**
+ * @brief Lower the given bound to the given value, if the value is smaller than it.
+ *        This method is lock free.
+ * @param bound The bound to lower.
+ * @param value The value to lower the bound to.
+ */
+static void lowerTo(std::atomic<CordType>& bound, CordType const value)
+{
+    CordType current = bound.load(std::memory_order_relaxed);
+    while (value < current && !bound.compare_exchange_weak(current, value,
+                                                           std::memory_order_relaxed))
+    {
+        // On failure the current bound was loaded into 'current', so we compare again.
+    }
+}
+
+/**
+ * @brief Raise the given bound to the given value, if the value is larger than it.
+ *        This method is lock free.
+ * @param bound The bound to raise.
+ * @param value The value to raise the bound to.
+ */
+static void raiseTo(std::atomic<CordType>& bound, CordType const value)
+{
+    CordType current = bound.load(std::memory_order_relaxed);
+    while (value > current && !bound.compare_exchange_weak(current, value,
+                                                           std::memory_order_relaxed))
+    {
+        // On failure the current bound was loaded into 'current', so we compare again.
+    }
+}
+
+
+/**
+ * @brief Publish the entry in the given position as the first entry of the given list.
+ *        This method is lock free.
+ * @param head The first entry of the list.
+ * @param index The position of the entry.
+ */
+void SpatialGrid::_pushEntry(std::atomic<EntryIndex>& head, EntryIndex const index)
+{
+    GridEntry& entry = _getEntry(index);
+    entry.next = head.load(std::memory_order_relaxed);
+    while (!head.compare_exchange_weak(entry.next, index, std::memory_order_release,
+                                       std::memory_order_relaxed))
+    {
+        // On failure the current head was loaded into 'entry.next', so we try again.
+    }
+}
+
+/**
+ * @brief Insert a Shape to every cell that it's Bounding Box covers in the lowest level where it
+ *        covers only a few cells, or to the list of the oversized Shapes if it covers too many
+ *        cells in every level. A Shape with a Bounding Box value that is not a number overlaps
+ *        no other Shape, so it is not inserted at all.
+ *        This method is lock free, and can be called by several threads at the same time.
+ * @param shape The index of the Shape in the ShapeStore.
+ * @param box The Bounding Box of the Shape.
+ */
+void SpatialGrid::insert(ShapeIndex const shape, const BoundingBox& box)
+{
+    if (!(box.getMinX() <= box.getMaxX() && box.getMinY() <= box.getMaxY()))
+    {
+        return;
+    }
+
+    for (int level = 0; level < GRID_LEVELS; level++)
+    {
+        CellCord minCellX = _getCell(box.getMinX(), level);
+        CellCord maxCellX = _getCell(box.getMaxX(), level);
+        CellCord minCellY = _getCell(box.getMinY(), level);
+        CellCord maxCellY = _getCell(box.getMaxY(), level);
+        if (hasMoreCells(minCellX, maxCellX, minCellY, maxCellY, MAX_CELLS_PER_SHAPE))
+        {
+            continue;
+        }
+
+        // The level and it's extent change only while the extent grows, so the threads rarely
+        // write to the same place.
+        unsigned int levelBit = 1u << level;
+        if ((_usedLevels.load(std::memory_order_relaxed) & levelBit) == 0)
+        {
+            _usedLevels.fetch_or(levelBit, std::memory_order_relaxed);
+        }
+        lowerTo(_levelMinX[level], box.getMinX());
+        raiseTo(_levelMaxX[level], box.getMaxX());
+        lowerTo(_levelMinY[level], box.getMinY());
+        raiseTo(_levelMaxY[level], box.getMaxY());
+        for (CellCord cellX = minCellX; cellX <= maxCellX; cellX++)
+        {
+            for (CellCord cellY = minCellY; cellY <= maxCellY; cellY++)
+            {
+                // Take a new entry, fill it, and only then publish it as the head of the bucket.
+                EntryIndex index = _entryCount.fetch_add(1, std::memory_order_relaxed);
+                GridEntry& entry = _getEntry(index);
+                entry.shape = shape;
+                entry.box = box;
+                entry.cellX = cellX;
+                entry.cellY = cellY;
+                entry.level = level;
+                _pushEntry(_buckets[_getBucket(cellX, cellY, level)], index);
+            }
+        }
+        return;
+    }
+
+    EntryIndex index = _entryCount.fetch_add(1, std::memory_order_relaxed);
+    GridEntry& entry = _getEntry(index);
+    entry.shape = shape;
+    entry.box = box;
+    entry.cellX = OVERSIZED_CELL;
+    entry.cellY = OVERSIZED_CELL;
+    entry.level = GRID_LEVELS;
+    _pushEntry(_oversized, index);
+    _oversizedCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Insert all the given Shapes to the grid, using all the worker threads.
+ * @param shapes The Shapes to insert.
+ */
+void SpatialGrid::build(const ShapeStore& shapes)
+{
+    parallelFor(shapes.size(), getThreadCount(), [this, &shapes](size_t begin, size_t end,
+                                                                 ThreadCount)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            insert(i, shapes.getBoundingBox(i));
+        }
+    });
+}
+
+
+/*-----=  SpatialGrid Queries  =-----*/
+
+
+/**
+ * @brief Find all the Shapes in the cells of the grid which their Bounding Box overlaps the
+ *        given Bounding Box, without the oversized Shapes. A query which covers so many cells in
+ *        all the levels that visiting them costs more than scanning all the entries scans the
+ *        entries instead.
+ * @param box The Bounding Box to query.
+ * @param result The Vector which the indices of the found Shapes are added to.
+ */
+void SpatialGrid::_queryCells(const BoundingBox& box, std::vector<ShapeIndex>& result) const
+{
+    if (!(box.getMinX() <= box.getMaxX() && box.getMinY() <= box.getMaxY()))
+    {
+        return;
+    }
+    unsigned int usedLevels = _usedLevels.load(std::memory_order_acquire);
+    EntryIndex entryCount = _entryCount.load(std::memory_order_acquire);
+
+    // The cells of all the levels inside their extents are counted against the cost of scanning
+    // all the entries.
+    CellCord cellBudget = (CellCord) (entryCount / CELL_VISIT_COST);
+    bool scan = false;
+    for (int level = 0; level < GRID_LEVELS && !scan; level++)
+    {
+        CellCord minCellX, maxCellX, minCellY, maxCellY;
+        if ((usedLevels & (1u << level)) == 0 ||
+            !_getLevelCells(box, level, minCellX, maxCellX, minCellY, maxCellY))
+        {
+            continue;
+        }
+        scan = hasMoreCells(minCellX, maxCellX, minCellY, maxCellY, cellBudget);
+        cellBudget -= scan ? 0 : (maxCellX - minCellX + 1) * (maxCellY - minCellY + 1);
+    }
+
+    if (scan)
+    {
+        // Every Shape in the cells is reported by it's entry in it's lowest cell.
+        for (EntryIndex index = 0; index < entryCount; index++)
+        {
+            const GridEntry& entry = _getEntry(index);
+            if (entry.cellX != OVERSIZED_CELL && entry.box.overlaps(box) && _isLowestCell(entry))
+            {
+                result.push_back(entry.shape);
+            }
+        }
+        return;
+    }
+
+    for (int level = 0; level < GRID_LEVELS; level++)
+    {
+        CellCord minCellX, maxCellX, minCellY, maxCellY;
+        if ((usedLevels & (1u << level)) == 0 ||
+            !_getLevelCells(box, level, minCellX, maxCellX, minCellY, maxCellY))
+        {
+            continue;
+        }
+        for (CellCord cellX = minCellX; cellX <= maxCellX; cellX++)
+        {
+            for (CellCord cellY = minCellY; cellY <= maxCellY; cellY++)
+            {
+                size_t bucket = _getBucket(cellX, cellY, level);
+                EntryIndex index = _buckets[bucket].load(std::memory_order_acquire);
+                for (; index != NO_ENTRY; index = _getEntry(index).next)
+                {
+                    const GridEntry& entry = _getEntry(index);
+                    if (entry.cellX != cellX || entry.cellY != cellY || entry.level != level ||
+                        !entry.box.overlaps(box))
+                    {
+                        continue;
+                    }
+
+                    // A Shape is reported only in the first cell it shares with the query.
+                    if (std::max(_getCell(entry.box.getMinX(), level), minCellX) == cellX &&
+                        std::max(_getCell(entry.box.getMinY(), level), minCellY) == cellY)
+                    {
+                        result.push_back(entry.shape);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Find all the Shapes which their Bounding Box overlaps the given Bounding Box.
+ *        Every Shape appears once in the result, even if it shares several cells with the
+ *        given Bounding Box. The oversized Shapes are checked one by one.
+ * @param box The Bounding Box to query.
+ * @param result The Vector which the indices of the found Shapes are added to.
+ */
+void SpatialGrid::query(const BoundingBox& box, std::vector<ShapeIndex>& result) const
+{
+    _queryCells(box, result);
+    EntryIndex index = _oversized.load(std::memory_order_acquire);
+    for (; index != NO_ENTRY; index = _getEntry(index).next)
+    {
+        const GridEntry& entry = _getEntry(index);
+        if (entry.box.overlaps(box))
+        {
+            result.push_back(entry.shape);
+        }
+    }
+}
+
+/**
+ * @brief Returns the positions of the entries of all the oversized Shapes.
+ * @return The positions of the entries of the oversized Shapes, from the smallest.
+ */
+std::vector<EntryIndex> SpatialGrid::_getOversized() const
+{
+    std::vector<EntryIndex> oversized;
+    EntryIndex index = _oversized.load(std::memory_order_acquire);
+    for (; index != NO_ENTRY; index = _getEntry(index).next)
+    {
+        oversized.push_back(index);
+    }
+    std::sort(oversized.begin(), oversized.end());
+    return oversized;
+}
+
+/**
+ * @brief Determine if the grid may have pairs of Shapes which are not of the same level.
+ * @param oversized The positions of the entries of all the oversized Shapes.
+ * @return true if there are oversized Shapes or Shapes in more than one level, false otherwise.
+ */
+bool SpatialGrid::_hasLevelPairs(const std::vector<EntryIndex>& oversized) const
+{
+    unsigned int usedLevels = _usedLevels.load(std::memory_order_acquire);
+    return !oversized.empty() || (usedLevels & (usedLevels - 1)) != 0;
+}
+
+/**
+ * @brief Find all the pairs of Shapes of the same level which share a cell in the given range of
+ *        buckets.
+ * @param begin The first bucket in the range.
+ * @param end The bucket after the last bucket in the range.
+ * @param job The job to run on every pair found.
+ */
+void SpatialGrid::_pairsInBuckets(size_t const begin, size_t const end,
+                                  const std::function<void(ShapeIndex, ShapeIndex)>& job) const
+{
+    std::vector<const GridEntry *> bucket;
+    for (size_t b = begin; b < end; b++)
+    {
+        bucket.clear();
+        EntryIndex index = _buckets[b].load(std::memory_order_acquire);
+        for (; index != NO_ENTRY; index = _getEntry(index).next)
+        {
+            bucket.push_back(&_getEntry(index));
+        }
+
+        for (auto i = bucket.begin(); i != bucket.end(); i++)
+        {
+            for (auto j = i + 1; j != bucket.end(); j++)
+            {
+                const GridEntry& a = **i;
+                const GridEntry& c = **j;
+
+                // Different cells may share a bucket, and the Shapes have to overlap.
+                if (a.cellX != c.cellX || a.cellY != c.cellY || a.level != c.level ||
+                    !a.box.overlaps(c.box))
+                {
+                    continue;
+                }
+
+                // The pair is reported only by the cell which holds the lowest corner of the
+                // overlap of the two boxes, so pairs that share several cells appear once.
+                CellCord cellX = _getCell(std::max(a.box.getMinX(), c.box.getMinX()), a.level);
+                CellCord cellY = _getCell(std::max(a.box.getMinY(), c.box.getMinY()), a.level);
+                if (cellX == a.cellX && cellY == a.cellY)
+                {
+                    job(std::min(a.shape, c.shape), std::max(a.shape, c.shape));
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Find all the pairs of Shapes which their Bounding Boxes overlap and are not of the same
+ *        level, where one Shape is in the given range of entries. A Shape in the cells is found
+ *        by it's entry in it's lowest cell, and it finds the Shapes of the higher levels and the
+ *        oversized Shapes. A pair of two oversized Shapes is found by the entry of the first of
+ *        them.
+ * @param oversized The positions of the entries of all the oversized Shapes, from the smallest.
+ * @param begin The first entry in the range.
+ * @param end The entry after the last entry in the range.
+ * @param job The job to run on every pair found.
+ */
+void SpatialGrid::_pairsOfLevels(const std::vector<EntryIndex>& oversized, size_t const begin,
+                                 size_t const end,
+                                 const std::function<void(ShapeIndex, ShapeIndex)>& job) const
+{
+    // Every entry in the range is compared with the oversized Shapes, which are copied aside so
+    // they stay in the cache while the entries are read in their order.
+    std::vector<GridEntry> large;
+    large.reserve(oversized.size());
+    for (auto i = oversized.begin(); i != oversized.end(); i++)
+    {
+        large.push_back(_getEntry(*i));
+    }
+    unsigned int usedLevels = _usedLevels.load(std::memory_order_acquire);
+
+    for (EntryIndex index = begin; index < end; index++)
+    {
+        const GridEntry& entry = _getEntry(index);
+        size_t other = 0;
+        if (entry.cellX == OVERSIZED_CELL)
+        {
+            other = std::upper_bound(oversized.begin(), oversized.end(), index) -
+                    oversized.begin();
+        }
+        else if (!_isLowestCell(entry))
+        {
+            continue;
+        }
+
+        // The Shape covers only a few cells of every higher level, since it covers only a few
+        // cells of it's own level. A pair is found in the cell of the higher level which holds
+        // the lowest corner of the overlap of the two boxes.
+        for (int level = entry.level + 1; level < GRID_LEVELS; level++)
+        {
+            if ((usedLevels & (1u << level)) == 0)
+            {
+                continue;
+            }
+            CellCord minCellX = _getCell(entry.box.getMinX(), level);
+            CellCord maxCellX = _getCell(entry.box.getMaxX(), level);
+            CellCord minCellY = _getCell(entry.box.getMinY(), level);
+            CellCord maxCellY = _getCell(entry.box.getMaxY(), level);
+            for (CellCord cellX = minCellX; cellX <= maxCellX; cellX++)
+            {
+                for (CellCord cellY = minCellY; cellY <= maxCellY; cellY++)
+                {
+                    size_t bucket = _getBucket(cellX, cellY, level);
+                    EntryIndex near = _buckets[bucket].load(std::memory_order_acquire);
+                    for (; near != NO_ENTRY; near = _getEntry(near).next)
+                    {
+                        const GridEntry& higher = _getEntry(near);
+                        if (higher.cellX == cellX && higher.cellY == cellY &&
+                            higher.level == level && higher.box.overlaps(entry.box) &&
+                            std::max(_getCell(higher.box.getMinX(), level), minCellX) == cellX &&
+                            std::max(_getCell(higher.box.getMinY(), level), minCellY) == cellY)
+                        {
+                            job(std::min(entry.shape, higher.shape),
+                                std::max(entry.shape, higher.shape));
+                        }
+                    }
+                }
+            }
+        }
+
+        for (; other < large.size(); other++)
+        {
+            if (entry.box.overlaps(large[other].box))
+            {
+                job(std::min(entry.shape, large[other].shape),
+                    std::max(entry.shape, large[other].shape));
+            }
+        }
+    }
+}
+
+/**
+ * @brief Find all the pairs of Shapes which their Bounding Boxes overlap. Every pair appears
+ *        once, in the cell of the higher level of the two that contains the lowest corner of the
+ *        overlap of the two boxes, or by the oversized Shape of the pair. The pairs are not
+ *        sorted.
+ * @param result The Vector which the found pairs are added to.
+ */
+void SpatialGrid::candidatePairs(PairVector& result) const
+{
+    auto job = [&result](ShapeIndex first, ShapeIndex second)
+    {
+        result.push_back({first, second});
+    };
+    _pairsInBuckets(0, _buckets.size(), job);
+    std::vector<EntryIndex> oversized = _getOversized();
+    if (_hasLevelPairs(oversized))
+    {
+        _pairsOfLevels(oversized, 0, _entryCount.load(std::memory_order_acquire), job);
+    }
+}
+
+/**
+ * @brief Find the first pair of intersecting Shapes, i.e. the pair with the smallest first
+ *        index, and among those the pair with the smallest second index.
+ *        Only Shapes which share a cell of the higher level of the two are checked, and the
+ *        oversized Shapes are checked against all the Shapes which their Bounding Boxes overlap,
+ *        using all the worker threads.
+ * @param shapes The ShapeStore which the grid was built from.
+ * @param first The index of the first Shape in the found pair.
+ * @param second The index of the second Shape in the found pair.
+ * @return true if there is at least one intersection, false otherwise.
+ */
+bool SpatialGrid::findFirstIntersection(const ShapeStore& shapes, ShapeIndex& first,
+                                        ShapeIndex& second) const
+{
+    // Every thread keeps the first pair it found in it's own part of the buckets, and then in
+    // it's own part of the entries which are compared with the higher levels.
+    ThreadCount threads = getThreadCount();
+    std::vector<ShapePair> best(threads, {shapes.size(), shapes.size()});
+    auto check = [&shapes](ShapePair& found, ShapeIndex i, ShapeIndex j)
+    {
+        // Pairs which come after the first pair found so far can not change the result.
+        if (i > found.first || (i == found.first && j >= found.second))
+        {
+            return;
+        }
+        if (shapesIntersect(shapes.getShape(i), shapes.getShape(j)))
+        {
+            found = {i, j};
+        }
+    };
+
+    parallelFor(_buckets.size(), threads, [this, &best, &check](size_t begin, size_t end,
+                                                                ThreadCount thread)
+    {
+        ShapePair& found = best[thread];
+        _pairsInBuckets(begin, end, [&found, &check](ShapeIndex i, ShapeIndex j)
+        {
+            check(found, i, j);
+        });
+    });
+    std::vector<EntryIndex> oversized = _getOversized();
+    EntryIndex entryCount = _hasLevelPairs(oversized) ?
+                            _entryCount.load(std::memory_order_acquire) : 0;
+    parallelFor(entryCount, threads, [this, &oversized, &best, &check](size_t begin, size_t end,
+                                                                       ThreadCount thread)
+    {
+        ShapePair& found = best[thread];
+        _pairsOfLevels(oversized, begin, end, [&found, &check](ShapeIndex i, ShapeIndex j)
+        {
+            check(found, i, j);
+        });
+    });
+
+    ShapePair result = {shapes.size(), shapes.size()};
+    for (auto i = best.begin(); i != best.end(); i++)
+    {
+        if (i -> first < result.first || (i -> first == result.first && i -> second < result.second))
+        {
+            result = *i;
+        }
+    }
+    first = result.first;
+    second = result.second;
+    return result.first != shapes.size();
+}
@@ -0,0 +1,310 @@
+/**
+ * @file SpatialGrid.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header File for the SpatialGrid Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the SpatialGrid Class.
+ * Declaring the SpatialGrid Class, it's methods and fields.
+ * A SpatialGrid class divides the plane into square cells, and holds for each cell the Shapes
+ * which their Bounding Box covers it. The grid has several levels, where the cells of every level
+ * are larger than the cells of the level below it, and every Shape is kept in the lowest level
+ * where it covers only a few cells, so a large Shape never fills the grid. The cells are stored in
+ * a hash table, so only cells which contain Shapes take memory. Shapes of the same level can only
+ * intersect if they share a cell, and a Shape is checked against the higher levels through the
+ * few cells it covers in each of them. A Shape which is too large even for the highest level is
+ * kept in a separate list of oversized Shapes, which is checked against all the other Shapes.
+ * Several worker threads can insert Shapes to the grid at the same time without any lock.
+ */
+
+
+#ifndef SPATIALGRID_H
+#define SPATIALGRID_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <atomic>
+#include <vector>
+#include <functional>
+#include "ShapeStore.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def GRID_BLOCKS 48
+ * @brief A Macro that sets the amount of blocks which hold the entries of the grid. Every block is
+ *        twice the size of the block before it, so the blocks can hold more entries than needed.
+ */
+#define GRID_BLOCKS 48
+
+/**
+ * @def GRID_LEVELS 8
+ * @brief A Macro that sets the amount of levels in the grid.
+ */
+#define GRID_LEVELS 8
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief CellCord is the coordinate of a cell in the grid, i.e. the amount of cells from the
+ *        origin along one axis.
+ */
+typedef long long CellCord;
+
+/**
+ * @brief EntryIndex is the position of an entry in the grid's entries storage.
+ */
+typedef size_t EntryIndex;
+
+/**
+ * @brief A Struct representing a single appearance of a Shape in a single cell of the grid.
+ */
+struct GridEntry
+{
+    ShapeIndex shape;  // The index of the Shape in the ShapeStore.
+    BoundingBox box;   // The Bounding Box of the Shape.
+    CellCord cellX;    // The X coordinate of the cell.
+    CellCord cellY;    // The Y coordinate of the cell.
+    int level;         // The level of the grid which the cell belongs to.
+    EntryIndex next;   // The next entry in the same bucket of the hash table.
+};
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class representing a grid of cells over the plane in several levels, which is used to
+ *        find the pairs of Shapes that are close enough to intersect.
+ *        Inserting Shapes is lock free, so worker threads can insert Shapes at the same time.
+ *        Queries should only run when no Shapes are being inserted.
+ */
+class SpatialGrid
+{
+public:
+
+    /**
+     * @brief A Constructor for the SpatialGrid.
+     * @param cellSize The length of the edge of every cell in the lowest level of the grid.
+     * @param expectedEntries The amount of entries the grid is expected to hold, which determines
+     *        the size of the hash table.
+     */
+    SpatialGrid(CordType const cellSize, size_t const expectedEntries);
+
+    /**
+     * @brief The Destructor for the SpatialGrid Class.
+     */
+    ~SpatialGrid();
+
+    /**
+     * @brief Choose the size of the cells in the lowest level for the given Shapes, according to
+     *        the extent of all the Shapes and the size of the smaller Shapes, so large Shapes do
+     *        not change it.
+     * @param shapes The Shapes that the grid will hold.
+     * @return The length of the edge of every cell in the lowest level of the grid.
+     */
+    static CordType chooseCellSize(const ShapeStore& shapes);
+
+    /**
+     * @brief Returns the length of the edge of every cell in the lowest level of the grid.
+     * @return The length of the edge of every cell in the lowest level of the grid.
+     */
+    CordType getCellSize() const { return _cellSizes[0]; };
+
+    /**
+     * @brief Returns the amount of oversized Shapes in the grid.
+     * @return The amount of oversized Shapes in the grid.
+     */
+    size_t getOversizedCount() const { return _oversizedCount.load(std::memory_order_relaxed); };
+
+    /**
+     * @brief Insert a Shape to every cell that it's Bounding Box covers in the lowest level where
+     *        it covers only a few cells, or to the list of the oversized Shapes if it covers too
+     *        many cells in every level. A Shape with a Bounding Box value that is not a number
+     *        overlaps no other Shape, so it is not inserted at all.
+     *        This method is lock free, and can be called by several threads at the same time.
+     * @param shape The index of the Shape in the ShapeStore.
+     * @param box The Bounding Box of the Shape.
+     */
+    void insert(ShapeIndex const shape, const BoundingBox& box);
+
+    /**
+     * @brief Insert all the given Shapes to the grid, using all the worker threads.
+     * @param shapes The Shapes to insert.
+     */
+    void build(const ShapeStore& shapes);
+
+    /**
+     * @brief Find all the Shapes which their Bounding Box overlaps the given Bounding Box.
+     *        Every Shape appears once in the result, even if it shares several cells with the
+     *        given Bounding Box. Every level is queried through it's cells, and the oversized
+     *        Shapes are checked one by one.
+     * @param box The Bounding Box to query.
+     * @param result The Vector which the indices of the found Shapes are added to.
+     */
+    void query(const BoundingBox& box, std::vector<ShapeIndex>& result) const;
+
+    /**
+     * @brief Find all the pairs of Shapes which their Bounding Boxes overlap. Every pair appears
+     *        once, in the cell of the higher level of the two that contains the lowest corner of
+     *        the overlap of the two boxes, or by the oversized Shape of the pair. The pairs are
+     *        not sorted.
+     * @param result The Vector which the found pairs are added to.
+     */
+    void candidatePairs(PairVector& result) const;
+
+    /**
+     * @brief Find the first pair of intersecting Shapes, i.e. the pair with the smallest first
+     *        index, and among those the pair with the smallest second index.
+     *        Only Shapes which share a cell of the higher level of the two are checked, and the
+     *        oversized Shapes are checked against all the Shapes which their Bounding Boxes
+     *        overlap, using all the worker threads.
+     * @param shapes The ShapeStore which the grid was built from.
+     * @param first The index of the first Shape in the found pair.
+     * @param second The index of the second Shape in the found pair.
+     * @return true if there is at least one intersection, false otherwise.
+     */
+    bool findFirstIntersection(const ShapeStore& shapes, ShapeIndex& first,
+                               ShapeIndex& second) const;
+
+private:
+    // SpatialGrid Private Fields.
+    CordType _cellSizes[GRID_LEVELS];                 // The length of the cells of every level.
+    std::vector<std::atomic<EntryIndex>> _buckets;    // The first entry in every hash bucket.
+    std::atomic<EntryIndex> _entryCount;              // The amount of entries taken so far.
+    std::atomic<GridEntry *> _blocks[GRID_BLOCKS];    // The blocks which hold the entries.
+    std::atomic<EntryIndex> _oversized;               // The first entry of an oversized Shape.
+    std::atomic<size_t> _oversizedCount;              // The amount of oversized Shapes.
+    std::atomic<unsigned int> _usedLevels;            // A bit for every level that has Shapes.
+    std::atomic<CordType> _levelMinX[GRID_LEVELS];    // The smallest X of every level's Shapes.
+    std::atomic<CordType> _levelMaxX[GRID_LEVELS];    // The largest X of every level's Shapes.
+    std::atomic<CordType> _levelMinY[GRID_LEVELS];    // The smallest Y of every level's Shapes.
+    std::atomic<CordType> _levelMaxY[GRID_LEVELS];    // The largest Y of every level's Shapes.
+
+    /**
+     * @brief Returns the coordinate of the cell which contains the given value on some axis.
+     * @param value The value on the axis.
+     * @param level The level of the grid.
+     * @return The coordinate of the cell.
+     */
+    CellCord _getCell(CordType const value, int const level) const;
+
+    /**
+     * @brief Returns the bucket in the hash table which holds the given cell.
+     * @param cellX The X coordinate of the cell.
+     * @param cellY The Y coordinate of the cell.
+     * @param level The level of the grid which the cell belongs to.
+     * @return The index of the bucket in the hash table.
+     */
+    size_t _getBucket(CellCord const cellX, CellCord const cellY, int const level) const;
+
+    /**
+     * @brief Find the cells of the given level which the given Bounding Box covers inside the
+     *        extent of the Shapes of this level, since the cells outside it are all empty.
+     * @param box The Bounding Box to find the cells of.
+     * @param level The level of the grid.
+     * @param minCellX The X coordinate of the first cell.
+     * @param maxCellX The X coordinate of the last cell.
+     * @param minCellY The Y coordinate of the first cell.
+     * @param maxCellY The Y coordinate of the last cell.
+     * @return true if the Bounding Box covers a part of the extent, false otherwise.
+     */
+    bool _getLevelCells(const BoundingBox& box, int const level, CellCord& minCellX,
+                        CellCord& maxCellX, CellCord& minCellY, CellCord& maxCellY) const;
+
+    /**
+     * @brief Determine if the given entry is in the lowest cell of it's Shape, which is the
+     *        entry that represents the Shape when every Shape should be found once.
+     * @param entry The entry of a Shape in a cell.
+     * @return true if the entry is in the lowest cell of it's Shape, false otherwise.
+     */
+    bool _isLowestCell(const GridEntry& entry) const;
+
+    /**
+     * @brief Returns the entry in the given position, allocating it's block if needed.
+     *        This method is lock free.
+     * @param index The position of the entry.
+     * @return A reference to the entry.
+     */
+    GridEntry& _getEntry(EntryIndex const index);
+
+    /**
+     * @brief Returns the entry in the given position.
+     * @param index The position of the entry.
+     * @return A reference to the entry.
+     */
+    const GridEntry& _getEntry(EntryIndex const index) const;
+
+    /**
+     * @brief Publish the entry in the given position as the first entry of the given list.
+     *        This method is lock free.
+     * @param head The first entry of the list.
+     * @param index The position of the entry.
+     */
+    void _pushEntry(std::atomic<EntryIndex>& head, EntryIndex const index);
+
+    /**
+     * @brief Find all the Shapes in the cells of the grid which their Bounding Box overlaps the
+     *        given Bounding Box, without the oversized Shapes. A query which covers so many
+     *        cells in all the levels that visiting them costs more than scanning all the entries
+     *        scans the entries instead.
+     * @param box The Bounding Box to query.
+     * @param result The Vector which the indices of the found Shapes are added to.
+     */
+    void _queryCells(const BoundingBox& box, std::vector<ShapeIndex>& result) const;
+
+    /**
+     * @brief Returns the positions of the entries of all the oversized Shapes.
+     * @return The positions of the entries of the oversized Shapes, from the smallest.
+     */
+    std::vector<EntryIndex> _getOversized() const;
+
+    /**
+     * @brief Determine if the grid may have pairs of Shapes which are not of the same level.
+     * @param oversized The positions of the entries of all the oversized Shapes.
+     * @return true if there are oversized Shapes or Shapes in more than one level, false
+     *         otherwise.
+     */
+    bool _hasLevelPairs(const std::vector<EntryIndex>& oversized) const;
+
+    /**
+     * @brief Find all the pairs of Shapes of the same level which share a cell in the given range
+     *        of buckets.
+     * @param begin The first bucket in the range.
+     * @param end The bucket after the last bucket in the range.
+     * @param job The job to run on every pair found.
+     */
+    void _pairsInBuckets(size_t const begin, size_t const end,
+                         const std::function<void(ShapeIndex, ShapeIndex)>& job) const;
+
+    /**
+     * @brief Find all the pairs of Shapes which their Bounding Boxes overlap and are not of the
+     *        same level, where one Shape is in the given range of entries. A Shape in the cells
+     *        is found by it's entry in it's lowest cell, and it finds the Shapes of the higher
+     *        levels and the oversized Shapes. A pair of two oversized Shapes is found by the
+     *        entry of the first of them.
+     * @param oversized The positions of the entries of all the oversized Shapes, from the
+     *        smallest.
+     * @param begin The first entry in the range.
+     * @param end The entry after the last entry in the range.
+     * @param job The job to run on every pair found.
+     */
+    void _pairsOfLevels(const std::vector<EntryIndex>& oversized, size_t const begin,
+                        size_t const end,
+                        const std::function<void(ShapeIndex, ShapeIndex)>& job) const;
+};
+
+
+#endif
@@ -0,0 +1,535 @@
+/**
+ * @file SpatialJoin.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A File for the spatial join of two sets of Shapes implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the spatial join of two sets of Shapes implementation.
+ * The partitions are cells of about the size which the Spatial Grid chooses for the larger
+ * Shapes of the two sets, and the amount of partitions along every axis is limited. Every set is
+ * placed in it's partitions by all the worker threads, and the entries are sorted by their
+ * partition and then by their smallest X value. The Shapes of a partition are then merged by a
+ * sweep along the X axis, the same way the Sweep Line finds the Shapes that overlap on the X axis.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cmath>
+#include <algorithm>
+#include "SpatialJoin.h"
+#include "SpatialGrid.h"
+#include "RTree.h"
+#include "ShapeKernels.h"
+#include "Parallel.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def MAX_PARTITIONS_PER_AXIS 1024
+ * @brief A Macro that sets the largest amount of partitions along one axis of the grid, which
+ *        keeps the amount of entries of a Shape that covers the whole grid limited.
+ */
+#define MAX_PARTITIONS_PER_AXIS 1024
+
+/**
+ * @def MAX_PARTITIONS_PER_SHAPE 64
+ * @brief A Macro that sets the largest amount of partitions which a single Shape is placed in.
+ *        A Shape which covers more partitions is joined through an R-Tree of the other set.
+ */
+#define MAX_PARTITIONS_PER_SHAPE 64
+
+/**
+ * @def SINGLE_PARTITION 1
+ * @brief A Macro that sets the amount of partitions along an axis which can not be divided.
+ */
+#define SINGLE_PARTITION 1
+
+/**
+ * @def FIRST_PARTITION 0
+ * @brief A Macro that sets the position of the first partition along an axis.
+ */
+#define FIRST_PARTITION 0
+
+/**
+ * @def TASK_BLOCK_SIZE 16
+ * @brief A Macro that sets the amount of partitions which a worker thread joins at once.
+ */
+#define TASK_BLOCK_SIZE 16
+
+/**
+ * @def LARGE_BLOCK_SIZE 1
+ * @brief A Macro that sets the amount of large Shapes which a worker thread joins at once.
+ */
+#define LARGE_BLOCK_SIZE 1
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief A Struct representing the grid of partitions which both sets of Shapes share.
+ */
+struct PartitionGrid
+{
+    BoundingBox extent;     // The part of the plane where the extents of both sets overlap.
+    size_t columns;         // The amount of partitions along the X axis.
+    size_t rows;            // The amount of partitions along the Y axis.
+};
+
+/**
+ * @brief A Struct representing a single appearance of a Shape in a single partition.
+ */
+struct JoinEntry
+{
+    size_t partition;   // The index of the partition, row after row.
+    ShapeIndex shape;   // The index of the Shape in it's set.
+    BoundingBox box;    // The Bounding Box of the Shape.
+};
+
+/**
+ * @brief A Struct representing a partition which holds Shapes of both sets, by the ranges of
+ *        it's entries in the sorted entries of every set.
+ */
+struct PartitionTask
+{
+    size_t partition;   // The index of the partition.
+    size_t firstBegin;  // The first entry of the partition in the entries of the first set.
+    size_t firstEnd;    // The entry after the last entry of the partition in the first set.
+    size_t secondBegin; // The first entry of the partition in the entries of the second set.
+    size_t secondEnd;   // The entry after the last entry of the partition in the second set.
+};
+
+
+/*-----=  Spatial Join Helpers  =-----*/
+
+
+/**
+ * @brief Determine if the given Bounding Box has it's smallest values before it's largest
+ *        values, which is false for an empty box and for a box with a value that is not a number.
+ * @param box The Bounding Box to check.
+ * @return true if the Bounding Box is ordered, false otherwise.
+ */
+static bool isOrdered(const BoundingBox& box)
+{
+    return box.getMinX() <= box.getMaxX() && box.getMinY() <= box.getMaxY();
+}
+
+/**
+ * @brief Returns the extent of all the ordered Bounding Boxes of the given Shapes.
+ * @param shapes The Shapes to find their extent.
+ * @return The extent of the Shapes, which is empty if no Shape has an ordered Bounding Box.
+ */
+static BoundingBox getExtent(const ShapeStore& shapes)
+{
+    BoundingBox extent;
+    for (ShapeIndex i = 0; i < shapes.size(); i++)
+    {
+        const BoundingBox& box = shapes.getBoundingBox(i);
+        if (isOrdered(box))
+        {
+            extent.expand(box);
+        }
+    }
+    return extent;
+}
+
+/**
+ * @brief Returns the amount of partitions along an axis of the given length.
+ * @param length The length of the grid along the axis.
+ * @param cellSize The length of the edge of a partition.
+ * @return The amount of partitions along the axis.
+ */
+static size_t countPartitions(CordType const length, CordType const cellSize)
+{
+    if (!std::isfinite(length))
+    {
+        return SINGLE_PARTITION;
+    }
+    CordType count = std::ceil(length / cellSize);
+    if (!(count < MAX_PARTITIONS_PER_AXIS))
+    {
+        return MAX_PARTITIONS_PER_AXIS;
+    }
+    return count > SINGLE_PARTITION ? (size_t) count : SINGLE_PARTITION;
+}
+
+/**
+ * @brief Returns the position of the partition which contains the given value along an axis.
+ *        Values outside the grid belong to the partitions on the edge of the grid.
+ * @param value The value on the axis.
+ * @param min The smallest value of the grid along the axis.
+ * @param max The largest value of the grid along the axis.
+ * @param count The amount of partitions along the axis.
+ * @return The position of the partition along the axis.
+ */
+static size_t getPartition(CordType const value, CordType const min, CordType const max,
+                           size_t const count)
+{
+    if (count == SINGLE_PARTITION)
+    {
+        return FIRST_PARTITION;
+    }
+    CordType position = std::floor((value - min) / (max - min) * count);
+    if (!(position > FIRST_PARTITION))
+    {
+        return FIRST_PARTITION;
+    }
+    return position < count ? (size_t) position : count - 1;
+}
+
+/**
+ * @brief Returns the column of the partition which contains the given X value.
+ * @param grid The grid of partitions.
+ * @param x The X value.
+ * @return The column of the partition.
+ */
+static size_t getColumn(const PartitionGrid& grid, CordType const x)
+{
+    return getPartition(x, grid.extent.getMinX(), grid.extent.getMaxX(), grid.columns);
+}
+
+/**
+ * @brief Returns the row of the partition which contains the given Y value.
+ * @param grid The grid of partitions.
+ * @param y The Y value.
+ * @return The row of the partition.
+ */
+static size_t getRow(const PartitionGrid& grid, CordType const y)
+{
+    return getPartition(y, grid.extent.getMinY(), grid.extent.getMaxY(), grid.rows);
+}
+
+/**
+ * @brief Place every Shape of the given set in every partition which it's Bounding Box covers,
+ *        using all the worker threads. A Shape outside the grid can not overlap a Shape of the
+ *        other set, so it is not placed at all, and a Shape which covers more than
+ *        MAX_PARTITIONS_PER_SHAPE partitions is kept aside as a large Shape. The entries are
+ *        sorted by their partition, then by their smallest X value and then by their Shape.
+ * @param shapes The set of Shapes to place.
+ * @param grid The grid of partitions.
+ * @param entries The Vector which the entries are written to.
+ * @param large The Vector which the large Shapes are written to, in their order.
+ */
+static void partitionShapes(const ShapeStore& shapes, const PartitionGrid& grid,
+                            std::vector<JoinEntry>& entries, std::vector<ShapeIndex>& large)
+{
+    ThreadCount threads = getThreadCount();
+    std::vector<std::vector<JoinEntry>> placed(threads);
+    std::vector<std::vector<ShapeIndex>> aside(threads);
+    parallelFor(shapes.size(), threads, [&shapes, &grid, &placed, &aside](size_t begin,
+                                                                          size_t end,
+                                                                          ThreadCount thread)
+    {
+        std::vector<JoinEntry>& own = placed[thread];
+        for (size_t i = begin; i < end; i++)
+        {
+            const BoundingBox& box = shapes.getBoundingBox(i);
+            if (!isOrdered(box) || !box.overlaps(grid.extent))
+            {
+                continue;
+            }
+            size_t firstColumn = getColumn(grid, box.getMinX());
+            size_t lastColumn = getColumn(grid, box.getMaxX());
+            size_t firstRow = getRow(grid, box.getMinY());
+            size_t lastRow = getRow(grid, box.getMaxY());
+            if ((lastColumn - firstColumn + 1) * (lastRow - firstRow + 1) >
+                MAX_PARTITIONS_PER_SHAPE)
+            {
+                aside[thread].push_back((ShapeIndex) i);
+                continue;
+            }
+            for (size_t row = firstRow; row <= lastRow; row++)
+            {
+                for (size_t column = firstColumn; column <= lastColumn; column++)
+                {
+                    own.push_back({row * grid.columns + column, (ShapeIndex) i, box});
+                }
+            }
+        }
+    });
+
+    // Every thread handled a continuous range of the Shapes, so the large Shapes stay in order.
+    entries.clear();
+    large.clear();
+    for (ThreadCount t = 0; t < threads; t++)
+    {
+        entries.insert(entries.end(), placed[t].begin(), placed[t].end());
+        large.insert(large.end(), aside[t].begin(), aside[t].end());
+    }
+    parallelSort(entries, 0, entries.size(), threads, [](const JoinEntry& a, const JoinEntry& b)
+    {
+        if (a.partition != b.partition)
+        {
+            return a.partition < b.partition;
+        }
+        if (a.box.getMinX() != b.box.getMinX())
+        {
+            return a.box.getMinX() < b.box.getMinX();
+        }
+        return a.shape < b.shape;
+    });
+}
+
+/**
+ * @brief Find the partitions which hold Shapes of both sets, by merging the sorted entries of
+ *        the two sets.
+ * @param firstEntries The sorted entries of the first set.
+ * @param secondEntries The sorted entries of the second set.
+ * @return The partitions to join, in their order.
+ */
+static std::vector<PartitionTask> findTasks(const std::vector<JoinEntry>& firstEntries,
+                                       const std::vector<JoinEntry>& secondEntries)
+{
+    std::vector<PartitionTask> tasks;
+    size_t first = 0;
+    size_t second = 0;
+    while (first < firstEntries.size() && second < secondEntries.size())
+    {
+        size_t partition = firstEntries[first].partition;
+        if (partition < secondEntries[second].partition)
+        {
+            first++;
+            continue;
+        }
+        if (secondEntries[second].partition < partition)
+        {
+            second++;
+            continue;
+        }
+
+        PartitionTask task = {partition, first, first, second, second};
+        while (task.firstEnd < firstEntries.size() &&
+               firstEntries[task.firstEnd].partition == partition)
+        {
+            task.firstEnd++;
+        }
+        while (task.secondEnd < secondEntries.size() &&
+               secondEntries[task.secondEnd].partition == partition)
+        {
+            task.secondEnd++;
+        }
+        tasks.push_back(task);
+        first = task.firstEnd;
+        second = task.secondEnd;
+    }
+    return tasks;
+}
+
+/**
+ * @brief Determine if the given pair of entries should be checked in the given partition, i.e.
+ *        their Bounding Boxes overlap on the Y axis, and the lowest corner of the overlap of
+ *        their Bounding Boxes is inside the partition. A pair which shares several partitions is
+ *        therefore checked only once.
+ * @param grid The grid of partitions.
+ * @param partition The index of the partition.
+ * @param first The entry of the Shape from the first set.
+ * @param second The entry of the Shape from the second set.
+ * @return true if the pair should be checked in the partition, false otherwise.
+ */
+static bool ownsPair(const PartitionGrid& grid, size_t const partition, const JoinEntry& first,
+                     const JoinEntry& second)
+{
+    if (first.box.getMinY() > second.box.getMaxY() || second.box.getMinY() > first.box.getMaxY())
+    {
+        return false;
+    }
+    CordType cornerX = std::max(first.box.getMinX(), second.box.getMinX());
+    CordType cornerY = std::max(first.box.getMinY(), second.box.getMinY());
+    return getRow(grid, cornerY) * grid.columns + getColumn(grid, cornerX) == partition;
+}
+
+/**
+ * @brief Join the Shapes of both sets in a single partition. The entries of both sets are swept
+ *        together along the X axis, and every entry is checked with the entries of the other
+ *        set which start before it ends.
+ * @param first The first set of Shapes.
+ * @param second The second set of Shapes.
+ * @param grid The grid of partitions.
+ * @param firstEntries The sorted entries of the first set.
+ * @param secondEntries The sorted entries of the second set.
+ * @param task The partition to join.
+ * @param pairs The Vector which the intersecting pairs are added to.
+ */
+static void joinPartition(const ShapeStore& first, const ShapeStore& second,
+                          const PartitionGrid& grid, const std::vector<JoinEntry>& firstEntries,
+                          const std::vector<JoinEntry>& secondEntries, const PartitionTask& task,
+                          PairVector& pairs)
+{
+    size_t i = task.firstBegin;
+    size_t j = task.secondBegin;
+    while (i < task.firstEnd && j < task.secondEnd)
+    {
+        if (firstEntries[i].box.getMinX() <= secondEntries[j].box.getMinX())
+        {
+            const JoinEntry& entry = firstEntries[i];
+            for (size_t k = j; k < task.secondEnd &&
+                               secondEntries[k].box.getMinX() <= entry.box.getMaxX(); k++)
+            {
+                const JoinEntry& other = secondEntries[k];
+                if (ownsPair(grid, task.partition, entry, other) &&
+                    intersectShapes(first.getShape(entry.shape), second.getShape(other.shape)))
+                {
+                    pairs.push_back({entry.shape, other.shape});
+                }
+            }
+            i++;
+        }
+        else
+        {
+            const JoinEntry& entry = secondEntries[j];
+            for (size_t k = i; k < task.firstEnd &&
+                               firstEntries[k].box.getMinX() <= entry.box.getMaxX(); k++)
+            {
+                const JoinEntry& other = firstEntries[k];
+                if (ownsPair(grid, task.partition, other, entry) &&
+                    intersectShapes(first.getShape(other.shape), second.getShape(entry.shape)))
+                {
+                    pairs.push_back({other.shape, entry.shape});
+                }
+            }
+            j++;
+        }
+    }
+}
+
+/**
+ * @brief Join every large Shape of one set with the Shapes of the other set which the given
+ *        R-Tree of the other set finds around it, using all the worker threads.
+ * @param shapes The set of the large Shapes.
+ * @param others The other set of Shapes, which the tree was built from.
+ * @param tree The R-Tree of the other set.
+ * @param large The large Shapes of the set.
+ * @param skipped true for every Shape of the other set which is not checked, or empty if every
+ *        Shape of the other set is checked.
+ * @param swap true if the large Shapes are from the second set, so every pair is swapped.
+ * @param found The Vectors of every worker thread which the intersecting pairs are added to.
+ */
+static void joinLarge(const ShapeStore& shapes, const ShapeStore& others, const RTree& tree,
+                      const std::vector<ShapeIndex>& large, const std::vector<bool>& skipped,
+                      bool const swap, std::vector<PairVector>& found)
+{
+    parallelForBlocks(large.size(), LARGE_BLOCK_SIZE, (ThreadCount) found.size(),
+                      [&shapes, &others, &tree, &large, &skipped, swap, &found]
+                      (size_t begin, size_t end, ThreadCount thread)
+    {
+        std::vector<ShapeIndex> candidates;
+        for (size_t i = begin; i < end; i++)
+        {
+            ShapeView shape = shapes.getShape(large[i]);
+            candidates.clear();
+            tree.query(shape.getBoundingBox(), candidates);
+            for (auto j = candidates.begin(); j != candidates.end(); j++)
+            {
+                if ((!skipped.empty() && skipped[*j]) ||
+                    !intersectShapes(swap ? others.getShape(*j) : shape,
+                                     swap ? shape : others.getShape(*j)))
+                {
+                    continue;
+                }
+                if (swap)
+                {
+                    found[thread].push_back({*j, large[i]});
+                }
+                else
+                {
+                    found[thread].push_back({large[i], *j});
+                }
+            }
+        }
+    });
+}
+
+
+/*-----=  Spatial Join Methods  =-----*/
+
+
+/**
+ * @brief Find all the pairs of intersecting Shapes where the first Shape is from the first set
+ *        and the second Shape is from the second set. The partitions are joined by all the worker
+ *        threads, and the pairs are sorted by their first index and then by their second index,
+ *        so the result does not depend on the amount of threads.
+ * @param first The first set of Shapes.
+ * @param second The second set of Shapes.
+ * @param result The Vector which the found pairs are added to, where the first index of a pair
+ *        is in the first set and the second index is in the second set.
+ */
+void joinShapes(const ShapeStore& first, const ShapeStore& second, PairVector& result)
+{
+    // Only the part of the plane where both extents overlap can hold an intersecting pair.
+    BoundingBox firstExtent = getExtent(first);
+    BoundingBox secondExtent = getExtent(second);
+    if (firstExtent.isEmpty() || secondExtent.isEmpty() || !firstExtent.overlaps(secondExtent))
+    {
+        return;
+    }
+    PartitionGrid grid;
+    grid.extent = BoundingBox(std::max(firstExtent.getMinX(), secondExtent.getMinX()),
+                              std::max(firstExtent.getMinY(), secondExtent.getMinY()),
+                              std::min(firstExtent.getMaxX(), secondExtent.getMaxX()),
+                              std::min(firstExtent.getMaxY(), secondExtent.getMaxY()));
+    CordType cellSize = std::max(SpatialGrid::chooseCellSize(first),
+                                 SpatialGrid::chooseCellSize(second));
+    grid.columns = countPartitions(grid.extent.getMaxX() - grid.extent.getMinX(), cellSize);
+    grid.rows = countPartitions(grid.extent.getMaxY() - grid.extent.getMinY(), cellSize);
+
+    std::vector<JoinEntry> firstEntries;
+    std::vector<JoinEntry> secondEntries;
+    std::vector<ShapeIndex> firstLarge;
+    std::vector<ShapeIndex> secondLarge;
+    partitionShapes(first, grid, firstEntries, firstLarge);
+    partitionShapes(second, grid, secondEntries, secondLarge);
+    std::vector<PartitionTask> tasks = findTasks(firstEntries, secondEntries);
+
+    ThreadCount threads = getThreadCount();
+    std::vector<PairVector> found(threads);
+    parallelForBlocks(tasks.size(), TASK_BLOCK_SIZE, threads,
+                      [&first, &second, &grid, &firstEntries, &secondEntries, &tasks, &found]
+                      (size_t begin, size_t end, ThreadCount thread)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            joinPartition(first, second, grid, firstEntries, secondEntries, tasks[i],
+                          found[thread]);
+        }
+    });
+
+    // The large Shapes of the first set are joined with all the second set, and the large
+    // Shapes of the second set only with the rest of the first set, so every pair is found once.
+    if (!firstLarge.empty())
+    {
+        RTree tree;
+        tree.build(second);
+        joinLarge(first, second, tree, firstLarge, std::vector<bool>(), false, found);
+    }
+    if (!secondLarge.empty())
+    {
+        std::vector<bool> skipped(first.size(), false);
+        for (auto i = firstLarge.begin(); i != firstLarge.end(); i++)
+        {
+            skipped[*i] = true;
+        }
+        RTree tree;
+        tree.build(first);
+        joinLarge(second, first, tree, secondLarge, skipped, true, found);
+    }
+
+    size_t begin = result.size();
+    for (auto i = found.begin(); i != found.end(); i++)
+    {
+        result.insert(result.end(), i -> begin(), i -> end());
+    }
+    parallelSort(result, begin, result.size(), threads, [](const ShapePair& a, const ShapePair& b)
+    {
+        return a.first < b.first || (a.first == b.first && a.second < b.second);
+    });
+}
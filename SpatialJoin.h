@@ -0,0 +1,51 @@
+/**
+ * @file SpatialJoin.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header File for the spatial join of two sets of Shapes.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the spatial join of two sets of Shapes.
+ * The join is a partition based spatial merge join: the part of the plane where the extents of
+ * both sets overlap is divided to a grid of partitions which both sets share, and every Shape is
+ * placed in every partition which it's Bounding Box covers. Only Shapes of different sets which
+ * share a partition are checked, so two Shapes of the same set are never checked. A pair which
+ * shares several partitions is checked only in the partition that contains the lowest corner of
+ * the overlap of their Bounding Boxes, so every pair is found once. A Shape which covers too
+ * many partitions is not placed in them, and is checked with the Shapes of the other set which
+ * an R-Tree of that set finds around it.
+ */
+
+
+#ifndef SPATIALJOIN_H
+#define SPATIALJOIN_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include "ShapeStore.h"
+
+
+/*-----=  Spatial Join Methods  =-----*/
+
+
+/**
+ * @brief Find all the pairs of intersecting Shapes where the first Shape is from the first set
+ *        and the second Shape is from the second set. The partitions are joined by all the worker
+ *        threads, and the pairs are sorted by their first index and then by their second index,
+ *        so the result does not depend on the amount of threads.
+ * @param first The first set of Shapes.
+ * @param second The second set of Shapes.
+ * @param result The Vector which the found pairs are added to, where the first index of a pair
+ *        is in the first set and the second index is in the second set.
+ */
+void joinShapes(const ShapeStore& first, const ShapeStore& second, PairVector& result);
+
+
+#endif
@@ -0,0 +1,121 @@
+/**
+ * @file StreamChecker.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A File for the StreamChecker Class implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the StreamChecker Class implementation.
+ * Define the StreamChecker Class, it's methods and fields.
+ * A StreamChecker class checks every new Shape against the Shapes that arrived before it, while
+ * the input is still being read. The earlier Shapes are kept in a Spatial Grid, which is built
+ * again with a fitting cell size every time the amount of Shapes doubles, or when too many of the
+ * new Shapes are too large for it's cells.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <cmath>
+#include "StreamChecker.h"
+#include "SweepLine.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def FIRST_CAPACITY 1024
+ * @brief A Macro that sets the amount of Shapes which the first grid is built for.
+ *        The first grid is built from the first Shape only, so it's cell size fits this Shape.
+ */
+#define FIRST_CAPACITY 1024
+
+/**
+ * @def CAPACITY_GROWTH 2
+ * @brief A Macro that sets the factor which the amount of Shapes grows by between two builds.
+ */
+#define CAPACITY_GROWTH 2
+
+/**
+ * @def OVERSIZED_GROWTH 2
+ * @brief A Macro that sets the factor which the amount of oversized Shapes in the grid may grow by
+ *        before the grid is built again.
+ */
+#define OVERSIZED_GROWTH 2
+
+
+/*-----=  StreamChecker Constructors  =-----*/
+
+
+/**
+ * @brief A Constructor for the StreamChecker, which creates a checker with no Shapes.
+ */
+StreamChecker::StreamChecker() : _capacity(0), _oversizedLimit(0)
+{
+
+}
+
+
+/*-----=  StreamChecker Methods  =-----*/
+
+
+/**
+ * @brief Build the grid again from all the given Shapes, with a cell size which fits them.
+ * @param shapes The Shapes to hold in the grid.
+ */
+void StreamChecker::_rebuild(const ShapeStore& shapes)
+{
+    _capacity = std::max((ShapeIndex) FIRST_CAPACITY, shapes.size() * CAPACITY_GROWTH);
+    _grid.reset(new SpatialGrid(SpatialGrid::chooseCellSize(shapes), _capacity));
+    _grid -> build(shapes);
+
+    // Every new oversized Shape is checked by every later query, so allowing about the square root
+    // of the amount of Shapes between two builds balances the queries against the builds.
+    _oversizedLimit = _grid -> getOversizedCount() * OVERSIZED_GROWTH +
+                      (size_t) std::sqrt((double) shapes.size());
+}
+
+/**
+ * @brief Check the last Shape in the given ShapeStore against all the Shapes before it,
+ *        and then add it to the checked Shapes.
+ * @param shapes The ShapeStore, where all the Shapes but the last were already added.
+ * @param first The smallest index of a Shape which intersects the last Shape.
+ * @return true if the last Shape intersects an earlier Shape, false otherwise.
+ */
+bool StreamChecker::addShape(const ShapeStore& shapes, ShapeIndex& first)
+{
+    ShapeIndex last = shapes.size() - 1;
+    ShapeView shape = shapes.getShape(last);
+
+    if (_grid != nullptr)
+    {
+        // Check the earlier Shapes in their order, so the first one found is the smallest.
+        _candidates.clear();
+        _grid -> query(shape.getBoundingBox(), _candidates);
+        std::sort(_candidates.begin(), _candidates.end());
+        if (findFirstCandidate(shapes, last, _candidates.data(), _candidates.size(), _batch,
+                               first))
+        {
+            return true;
+        }
+    }
+
+    // Building the grid on every doubling costs a constant amount of work per Shape.
+    if (shapes.size() > _capacity || _grid -> getOversizedCount() > _oversizedLimit)
+    {
+        _rebuild(shapes);
+    }
+    else
+    {
+        _grid -> insert(last, shape.getBoundingBox());
+    }
+    return false;
+}
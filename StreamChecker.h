@@ -0,0 +1,78 @@
+/**
+ * @file StreamChecker.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header File for the StreamChecker Class.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the StreamChecker Class.
+ * Declaring the StreamChecker Class, it's methods and fields.
+ * A StreamChecker class checks every new Shape against the Shapes that arrived before it, while
+ * the input is still being read. The earlier Shapes are kept in a Spatial Grid, which is built
+ * again with a fitting cell size every time the amount of Shapes doubles, or when too many of the
+ * new Shapes are too large for it's cells.
+ */
+
+
+#ifndef STREAMCHECKER_H
+#define STREAMCHECKER_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <memory>
+#include <vector>
+#include "ShapeStore.h"
+#include "SpatialGrid.h"
+#include "EdgeBatch.h"
+
+
+/*-----=  Class Declaration  =-----*/
+
+
+/**
+ * @brief A Class representing an incremental intersection check over Shapes which arrive one by
+ *        one. The first pair it finds is the pair with the smallest second index, and among those
+ *        the pair with the smallest first index.
+ */
+class StreamChecker
+{
+public:
+
+    /**
+     * @brief A Constructor for the StreamChecker, which creates a checker with no Shapes.
+     */
+    StreamChecker();
+
+    /**
+     * @brief Check the last Shape in the given ShapeStore against all the Shapes before it,
+     *        and then add it to the checked Shapes.
+     * @param shapes The ShapeStore, where all the Shapes but the last were already added.
+     * @param first The smallest index of a Shape which intersects the last Shape.
+     * @return true if the last Shape intersects an earlier Shape, false otherwise.
+     */
+    bool addShape(const ShapeStore& shapes, ShapeIndex& first);
+
+private:
+    // StreamChecker Private Fields.
+    std::unique_ptr<SpatialGrid> _grid;    // The grid which holds the Shapes added so far.
+    ShapeIndex _capacity;                  // The amount of Shapes which causes the next build.
+    size_t _oversizedLimit;                // The amount of oversized Shapes which causes a build.
+    std::vector<ShapeIndex> _candidates;   // The Shapes which the last query found.
+    EdgeBatch _batch;                      // The edges of the candidates of the last query.
+
+    /**
+     * @brief Build the grid again from all the given Shapes, with a cell size which fits them.
+     * @param shapes The Shapes to hold in the grid.
+     */
+    void _rebuild(const ShapeStore& shapes);
+};
+
+
+#endif
@@ -0,0 +1,353 @@
+/**
+ * @file SweepLine.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A File for the Sweep Line intersection engine implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the Sweep Line intersection engine implementation.
+ * The Sweep Line moves along the X axis over the extents of all the Shapes' edges and keeps
+ * only the Shapes that the line currently crosses. The active Shapes are kept in a tree over the
+ * order of their smallest Y values, where every node keeps the largest Y value of the active
+ * Shapes under it, so a new Shape visits only the active Shapes which their Y range overlaps it's
+ * own. A Shape that the line already passed is removed when it is first visited. The Sweep Line
+ * therefore takes O((n + k) * log(n)) time, where k is the amount of pairs of Shapes which their
+ * Bounding Boxes overlap.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <algorithm>
+#include <limits>
+#include "SweepLine.h"
+#include "ShapeKernels.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def BATCH_MIN_CANDIDATES 8
+ * @brief A Macro that sets the smallest amount of candidates which are checked as a batch.
+ *        Shorter lists are checked one by one, which stops at the first intersecting candidate.
+ */
+#define BATCH_MIN_CANDIDATES 8
+
+/**
+ * @def NO_REACH (-std::numeric_limits<CordType>::infinity())
+ * @brief A Macro that sets the largest Y value of a node of the active tree with no active Shape.
+ */
+#define NO_REACH (-std::numeric_limits<CordType>::infinity())
+
+/**
+ * @def ROOT_NODE 1
+ * @brief A Macro that sets the index of the root node of the active tree.
+ */
+#define ROOT_NODE 1
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief IndexVector is a Vector of Shapes indices.
+ */
+typedef std::vector<ShapeIndex> IndexVector;
+
+/**
+ * @brief A Struct representing the Shapes that the Sweep Line currently crosses, as a tree over
+ *        the order of the smallest Y values of all the Shapes. Leaf number r belongs to the Shape
+ *        with the r-th smallest Y value, and every node keeps the largest Y value of the active
+ *        Shapes under it.
+ */
+struct ActiveTree
+{
+    size_t leaves;                  // The amount of leaves, which is a power of 2.
+    std::vector<CordType> reach;    // The largest Y value of the active Shapes under every node.
+    std::vector<char> active;       // true for every leaf which holds an active Shape.
+};
+
+
+/*-----=  Sweep Line Helpers  =-----*/
+
+
+/**
+ * @brief Check a pair of Shapes that the Sweep Line found active together, and update the
+ *        first pair found so far if this pair intersects and comes before it.
+ *        Pairs that come after the first pair found so far are not checked at all.
+ * @param shapes The ShapeStore which holds the Shapes to check.
+ * @param a The index of one Shape in the pair.
+ * @param b The index of the other Shape in the pair.
+ * @param found true if a pair was already found.
+ * @param first The index of the first Shape in the first pair found so far.
+ * @param second The index of the second Shape in the first pair found so far.
+ */
+static void checkPair(const ShapeStore& shapes, ShapeIndex a, ShapeIndex b, bool& found,
+                      ShapeIndex& first, ShapeIndex& second)
+{
+    ShapeIndex i = std::min(a, b);
+    ShapeIndex j = std::max(a, b);
+
+    // Pairs which come after the current first pair can not change the result.
+    if (found && (i > first || (i == first && j >= second)))
+    {
+        return;
+    }
+
+    if (shapesIntersect(shapes.getShape(i), shapes.getShape(j)))
+    {
+        found = true;
+        first = i;
+        second = j;
+    }
+}
+
+
+/**
+ * @brief Set the largest Y value of the given leaf of the active tree, and update the nodes
+ *        above it.
+ * @param tree The active tree.
+ * @param rank The position of the leaf.
+ * @param value The largest Y value of the leaf, or NO_REACH for a leaf with no active Shape.
+ */
+static void setReach(ActiveTree& tree, size_t const rank, CordType const value)
+{
+    size_t node = tree.leaves + rank;
+    tree.reach[node] = value;
+    for (node /= 2; node >= ROOT_NODE; node /= 2)
+    {
+        tree.reach[node] = std::max(tree.reach[2 * node], tree.reach[2 * node + 1]);
+    }
+}
+
+/**
+ * @brief Find the active Shapes under the given node of the active tree which their position is
+ *        before the given limit, and which their largest Y value is not below the given value.
+ * @param tree The active tree.
+ * @param node The node to search under.
+ * @param begin The position of the first leaf under the node.
+ * @param end The position after the last leaf under the node.
+ * @param limit The position after the last leaf to find.
+ * @param low The smallest largest Y value to find.
+ * @param found The Vector which the positions of the found leaves are added to.
+ */
+static void findActive(const ActiveTree& tree, size_t const node, size_t const begin,
+                       size_t const end, size_t const limit, CordType const low,
+                       std::vector<size_t>& found)
+{
+    if (begin >= limit || tree.reach[node] < low)
+    {
+        return;
+    }
+    if (node >= tree.leaves)
+    {
+        if (tree.active[begin])
+        {
+            found.push_back(begin);
+        }
+        return;
+    }
+    size_t middle = begin + (end - begin) / 2;
+    findActive(tree, 2 * node, begin, middle, limit, low, found);
+    findActive(tree, 2 * node + 1, middle, end, limit, low, found);
+}
+
+
+/*-----=  Sweep Line Methods  =-----*/
+
+
+/**
+ * @brief Determine if the 2 given Shapes intersect, i.e. they have some edges that intersect
+ *        with each other, or one of them is a sub-set of the other.
+ *        Shapes which their Bounding Boxes do not overlap are rejected without further checks.
+ * @param first The first Shape to check.
+ * @param second The second Shape to check.
+ * @return true if the Shapes intersect, false otherwise.
+ */
+bool shapesIntersect(const ShapeView& first, const ShapeView& second)
+{
+    // Shapes which are far apart are rejected before any edge or Vertex is checked.
+    // The kernel of their pair of types checks the edges and the Vertices with no virtual call.
+    return first.getBoundingBox().overlaps(second.getBoundingBox()) &&
+           intersectShapes(first, second);
+}
+
+/**
+ * @brief Find the first Shape out of the given candidates which intersects the given Shape.
+ *        A long list of candidates is checked as a batch: the edges of all the candidates are
+ *        checked against every edge of the Shape several at a time, and only the candidates
+ *        before the first crossing edge are checked for a sub-set. The found Shape is the same
+ *        as checking the candidates one by one.
+ * @param shapes The ShapeStore which holds the Shapes to check.
+ * @param shape The index of the Shape to check.
+ * @param candidates The indices of the Shapes to check with, sorted from the smallest.
+ * @param count The amount of candidates.
+ * @param batch The batch which holds the edges of the candidates during the check.
+ * @param found The smallest candidate which intersects the Shape.
+ * @return true if a candidate intersects the Shape, false otherwise.
+ */
+bool findFirstCandidate(const ShapeStore& shapes, ShapeIndex const shape,
+                        const ShapeIndex *candidates, size_t const count, EdgeBatch& batch,
+                        ShapeIndex& found)
+{
+    ShapeView view = shapes.getShape(shape);
+    if (count < BATCH_MIN_CANDIDATES)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            if (shapesIntersect(view, shapes.getShape(candidates[i])))
+            {
+                found = candidates[i];
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Only candidates which their Bounding Boxes overlap the Shape are added, in their order.
+    batch.clear();
+    for (size_t i = 0; i < count; i++)
+    {
+        if (view.getBoundingBox().overlaps(shapes.getBoundingBox(candidates[i])))
+        {
+            batch.add(shapes.getShape(candidates[i]), candidates[i]);
+        }
+    }
+
+    // The edges are in the order of the candidates, so the lowest edge which crosses an edge of
+    // the Shape belongs to the smallest candidate with a crossing edge.
+    ShapeIndex crossing = shapes.size();
+    ShapeSize vertexCount = view.getVertexCount();
+    for (size_t begin = 0; begin < batch.size() && crossing == shapes.size();
+         begin += EDGE_BATCH_SIZE)
+    {
+        EdgeMask crossings = 0;
+        for (ShapeSize i = 0; i < vertexCount; i++)
+        {
+            ShapeSize j = i + 1 == vertexCount ? 0 : i + 1;
+            QueryEdge query = {view.getX(i), view.getY(i), view.getX(j), view.getY(j),
+                               view.getEdge(i)};
+            crossings |= batch.findCrossings(query, begin);
+        }
+        for (size_t edge = begin; crossings != 0; edge++, crossings >>= 1)
+        {
+            if (crossings & 1)
+            {
+                crossing = batch.getOwner(edge);
+                break;
+            }
+        }
+    }
+
+    // The candidates before it intersect the Shape only if one of them is a sub-set of the other.
+    for (size_t i = 0; i < count && candidates[i] < crossing; i++)
+    {
+        ShapeView other = shapes.getShape(candidates[i]);
+        if (view.getBoundingBox().overlaps(other.getBoundingBox()) && view.subsetOf(other))
+        {
+            found = candidates[i];
+            return true;
+        }
+    }
+    if (crossing != shapes.size())
+    {
+        found = crossing;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Find the first pair of intersecting Shapes in the given ShapeStore.
+ *        The first pair is the pair with the smallest first index, and among those the pair
+ *        with the smallest second index, which is the same pair that comparing each Shape with
+ *        all the Shapes after it in the store would find. Shapes which their Bounding Boxes do
+ *        not overlap are never reported, even where the rounding of the original Determinants
+ *        found a crossing between two far apart Trapezoids with bases on the same line.
+ * @param shapes The ShapeStore which holds the Shapes to check.
+ * @param first The index of the first Shape in the found pair.
+ * @param second The index of the second Shape in the found pair.
+ * @return true if there is at least one intersection, false otherwise.
+ */
+bool findFirstIntersection(const ShapeStore& shapes, ShapeIndex& first, ShapeIndex& second)
+{
+    // A Shape with a value that is not a number overlaps no Bounding Box, so it never intersects.
+    IndexVector events;
+    events.reserve(shapes.size());
+    for (ShapeIndex i = 0; i < shapes.size(); i++)
+    {
+        const BoundingBox& box = shapes.getBoundingBox(i);
+        if (box.getMinX() <= box.getMaxX() && box.getMinY() <= box.getMaxY())
+        {
+            events.push_back(i);
+        }
+    }
+
+    // Every Shape gets the leaf of it's position in the order of the smallest Y values.
+    IndexVector byY = events;
+    std::sort(byY.begin(), byY.end(), [&shapes](ShapeIndex a, ShapeIndex b)
+    {
+        CordType aY = shapes.getBoundingBox(a).getMinY();
+        CordType bY = shapes.getBoundingBox(b).getMinY();
+        return aY < bY || (aY == bY && a < b);
+    });
+    std::vector<CordType> lows(byY.size());
+    std::vector<size_t> ranks(shapes.size());
+    for (size_t rank = 0; rank < byY.size(); rank++)
+    {
+        lows[rank] = shapes.getBoundingBox(byY[rank]).getMinY();
+        ranks[byY[rank]] = rank;
+    }
+    ActiveTree tree;
+    tree.leaves = 1;
+    while (tree.leaves < byY.size())
+    {
+        tree.leaves *= 2;
+    }
+    tree.reach.assign(2 * tree.leaves, NO_REACH);
+    tree.active.assign(tree.leaves, false);
+
+    // The Sweep Line visits the Shapes by the smallest X value of their edges.
+    std::sort(events.begin(), events.end(), [&shapes](ShapeIndex a, ShapeIndex b)
+    {
+        CordType aX = shapes.getBoundingBox(a).getMinX();
+        CordType bX = shapes.getBoundingBox(b).getMinX();
+        return aX < bX || (aX == bX && a < b);
+    });
+
+    bool found = false;
+    std::vector<size_t> overlapping;
+    for (auto event = events.begin(); event != events.end(); event++)
+    {
+        const BoundingBox& box = shapes.getBoundingBox(*event);
+        CordType sweepX = box.getMinX();
+
+        // Only the active Shapes which start below the top of the new Shape and end above it's
+        // bottom are visited. Shapes that the Sweep Line already passed are removed, and Shapes
+        // which only touch the Sweep Line are kept, since touching Shapes may still intersect.
+        size_t limit = std::upper_bound(lows.begin(), lows.end(), box.getMaxY()) - lows.begin();
+        overlapping.clear();
+        findActive(tree, ROOT_NODE, 0, tree.leaves, limit, box.getMinY(), overlapping);
+        for (auto i = overlapping.begin(); i != overlapping.end(); i++)
+        {
+            ShapeIndex other = byY[*i];
+            if (shapes.getBoundingBox(other).getMaxX() < sweepX)
+            {
+                tree.active[*i] = false;
+                setReach(tree, *i, NO_REACH);
+                continue;
+            }
+            checkPair(shapes, other, *event, found, first, second);
+        }
+        tree.active[ranks[*event]] = true;
+        setReach(tree, ranks[*event], box.getMaxY());
+    }
+    return found;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file SweepLine.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header File for the Sweep Line intersection engine.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the Sweep Line intersection engine.
+ * The Sweep Line moves along the X axis over the extents of all the Shapes' edges and keeps
+ * only the Shapes that the line currently crosses, ordered by their Y values. Only Shapes which
+ * their Bounding Boxes overlap are checked for intersection, which reduces the time from a
+ * quadratic amount to O((n + k) * log(n)), where k is the amount of these pairs.
+ */
+
+
+#ifndef SWEEPLINE_H
+#define SWEEPLINE_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include "ShapeStore.h"
+#include "EdgeBatch.h"
+
+
+/*-----=  Sweep Line Methods  =-----*/
+
+
+/**
+ * @brief Determine if the 2 given Shapes intersect, i.e. they have some edges that intersect
+ *        with each other, or one of them is a sub-set of the other.
+ *        Shapes which their Bounding Boxes do not overlap are rejected without further checks.
+ * @param first The first Shape to check.
+ * @param second The second Shape to check.
+ * @return true if the Shapes intersect, false otherwise.
+ */
+bool shapesIntersect(const ShapeView& first, const ShapeView& second);
+
+/**
+ * @brief Find the first Shape out of the given candidates which intersects the given Shape.
+ *        A long list of candidates is checked as a batch: the edges of all the candidates are
+ *        checked against every edge of the Shape several at a time, and only the candidates
+ *        before the first crossing edge are checked for a sub-set. The found Shape is the same
+ *        as checking the candidates one by one.
+ * @param shapes The ShapeStore which holds the Shapes to check.
+ * @param shape The index of the Shape to check.
+ * @param candidates The indices of the Shapes to check with, sorted from the smallest.
+ * @param count The amount of candidates.
+ * @param batch The batch which holds the edges of the candidates during the check.
+ * @param found The smallest candidate which intersects the Shape.
+ * @return true if a candidate intersects the Shape, false otherwise.
+ */
+bool findFirstCandidate(const ShapeStore& shapes, ShapeIndex const shape,
+                        const ShapeIndex *candidates, size_t const count, EdgeBatch& batch,
+                        ShapeIndex& found);
+
+/**
+ * @brief Find the first pair of intersecting Shapes in the given ShapeStore.
+ *        The first pair is the pair with the smallest first index, and among those the pair
+ *        with the smallest second index, which is the same pair that comparing each Shape with
+ *        all the Shapes after it in the store would find. Shapes which their Bounding Boxes do
+ *        not overlap are never reported, even where the rounding of the original Determinants
+ *        found a crossing between two far apart Trapezoids with bases on the same line.
+ * @param shapes The ShapeStore which holds the Shapes to check.
+ * @param first The index of the first Shape in the found pair.
+ * @param second The index of the second Shape in the found pair.
+ * @return true if there is at least one intersection, false otherwise.
+ */
+bool findFirstIntersection(const ShapeStore& shapes, ShapeIndex& first, ShapeIndex& second);
+
+
+#endif
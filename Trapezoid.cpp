@@ -24,22 +24,6 @@
 #include "Trapezoid.h"
 
 
-/*-----=  Definitions  =-----*/
-
-
-/**
- * @def TRAPEZOID_POINTS 4
- * @brief A Macro that sets the valid number for Points in a Trapezoid.
- */
-#define TRAPEZOID_POINTS 4
-
-/**
- * @def TRAPEZOID_TYPE "Trapezoid"
- * @brief A Macro that sets the type name for the Trapezoid Shape.
- */
-#define TRAPEZOID_TYPE "Trapezoid"
-
-
 /*-----=  Constructors & Destructors  =-----*/
 
 
@@ -52,7 +36,7 @@
  *        area value of the Trapezoid.
  * @param points Vector of Points which will be the Trapezoid's vertices.
  */
-Trapezoid::Trapezoid(const PointVector& points) : Shape(TRAPEZOID_TYPE, points)
+Trapezoid::Trapezoid(const PointVector& points) : Shape(TRAPEZOID, points)
 {
     if (_points.size() == TRAPEZOID_POINTS)
     {
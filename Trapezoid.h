@@ -29,6 +29,22 @@
 /*-----=  Definitions  =-----*/
 
 
+/**
+ * @def TRAPEZOID_POINTS 4
+ * @brief A Macro that sets the valid number for Points in a Trapezoid.
+ */
+#define TRAPEZOID_POINTS 4
+
+/**
+ * @def TRAPEZOID_TYPE "Trapezoid"
+ * @brief A Macro that sets the type name for the Trapezoid Shape.
+ */
+#define TRAPEZOID_TYPE "Trapezoid"
+
+
+/*-----=  Class Definitions  =-----*/
+
+
 /**
  * @brief A Class representing a Trapezoid Shape. The Trapezoid inherits from the Abstract Shape.
  *        A Shape holds it's Vertices and contains several methods which perform operations
@@ -23,22 +23,6 @@
 #include "Triangle.h"
 
 
-/*-----=  Definitions  =-----*/
-
-
-/**
- * @def TRIANGLE_POINTS 3
- * @brief A Macro that sets the valid number for Points in a Triangle.
- */
-#define TRIANGLE_POINTS 3
-
-/**
- * @def TRIANGLE_TYPE "Triangle"
- * @brief A Macro that sets the type name for the Triangle Shape.
- */
-#define TRIANGLE_TYPE "Triangle"
-
-
 /*-----=  Constructors & Destructors  =-----*/
 
 
@@ -51,7 +35,7 @@
  *        area value of the Triangle.
  * @param points Vector of Points which will be the Triangle's vertices.
  */
-Triangle::Triangle(const PointVector& points) : Shape(TRIANGLE_TYPE, points)
+Triangle::Triangle(const PointVector& points) : Shape(TRIANGLE, points)
 {
     if (_points.size() == TRIANGLE_POINTS)
     {
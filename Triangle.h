@@ -29,6 +29,22 @@
 /*-----=  Definitions  =-----*/
 
 
+/**
+ * @def TRIANGLE_POINTS 3
+ * @brief A Macro that sets the valid number for Points in a Triangle.
+ */
+#define TRIANGLE_POINTS 3
+
+/**
+ * @def TRIANGLE_TYPE "Triangle"
+ * @brief A Macro that sets the type name for the Triangle Shape.
+ */
+#define TRIANGLE_TYPE "Triangle"
+
+
+/*-----=  Class Definitions  =-----*/
+
+
 /**
  * @brief A Class representing a Triangle Shape. The Triangle inherits from the Abstract Shape.
  *        A Shape holds it's Vertices and contains several methods which perform operations
@@ -0,0 +1,677 @@
+/**
+ * @file UnionArea.cpp
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A File for the area of the union of the Shapes implementation.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A File for the area of the union of the Shapes implementation.
+ * The groups are found by joining the pairs of Shapes as the R-Tree finds them, where every
+ * worker thread joins it's pairs in it's own groups, and the groups of the threads are joined at
+ * the end, so the pairs are never kept. The slabs of every group are split to tasks of
+ * neighbouring slabs, which the worker threads take in their order. A task keeps the Shapes
+ * which cross it's current slab while it moves up, so a Shape is added once and dropped once in
+ * every task.
+ * The areas are summed with the compensated sum of Neumaier, which keeps the rounding error of
+ * every addition aside and adds it at the end, so many small parts are not lost next to a large
+ * total.
+ */
+
+
+/*-----=  Includes  =-----*/
+
+
+#include <cmath>
+#include <algorithm>
+#include <functional>
+#include "UnionArea.h"
+#include "RTree.h"
+#include "Parallel.h"
+
+
+/*-----=  Definitions  =-----*/
+
+
+/**
+ * @def SLABS_PER_TASK 64
+ * @brief A Macro that sets the largest amount of neighbouring slabs which a worker thread
+ *        handles at once.
+ */
+#define SLABS_PER_TASK 64
+
+/**
+ * @def TASK_BLOCK_SIZE 1
+ * @brief A Macro that sets the amount of tasks which a worker thread takes at once.
+ */
+#define TASK_BLOCK_SIZE 1
+
+/**
+ * @def EMPTY_AREA 0
+ * @brief A Macro that sets the area of an empty part of the plane.
+ */
+#define EMPTY_AREA 0
+
+/**
+ * @def OPEN_DEPTH 1
+ * @brief A Macro that sets the change of the depth after the left side of a Shape.
+ */
+#define OPEN_DEPTH 1
+
+/**
+ * @def CLOSE_DEPTH -1
+ * @brief A Macro that sets the change of the depth after the right side of a Shape.
+ */
+#define CLOSE_DEPTH -1
+
+/**
+ * @def SLAB_BOTTOM_PART 0
+ * @brief A Macro that sets the part of the height of a slab at it's bottom.
+ */
+#define SLAB_BOTTOM_PART 0
+
+/**
+ * @def SLAB_TOP_PART 1
+ * @brief A Macro that sets the part of the height of a slab at it's top.
+ */
+#define SLAB_TOP_PART 1
+
+/**
+ * @def HALF 0.5
+ * @brief A Macro that sets the factor of the average of two values.
+ */
+#define HALF 0.5
+
+
+/*-----=  Type Definitions  =-----*/
+
+
+/**
+ * @brief A Struct representing a compensated sum, which keeps the rounding error of it's
+ *        additions aside.
+ */
+struct CompensatedSum
+{
+    CordType sum;           // The rounded sum of the values.
+    CordType compensation;  // The sum of the rounding errors of the additions.
+};
+
+/**
+ * @brief A Struct representing a side of a Shape which crosses a slab, by it's X values at the
+ *        bottom and at the top of the slab.
+ */
+struct SlabSide
+{
+    CordType bottom;    // The X value of the side at the bottom of the slab.
+    CordType top;       // The X value of the side at the top of the slab.
+    int depth;          // 1 for a left side, which opens the Shape, and -1 for a right side.
+    size_t id;          // The index of the side in the order it was found.
+};
+
+/**
+ * @brief A Struct representing the point in a slab where two neighbouring sides cross, by it's
+ *        part of the height of the slab.
+ */
+struct SideCrossing
+{
+    CordType part;      // The part of the height of the slab, between 0 and 1.
+    size_t position;    // The position of the left side of the two, before they cross.
+    size_t left;        // The id of the left side before they cross.
+    size_t right;       // The id of the right side before they cross.
+
+    /**
+     * @brief Determine if this crossing comes after the given crossing, so the queue of the
+     *        crossings gives out the lowest crossing first.
+     * @param other The crossing to compare with.
+     * @return true if this crossing is higher in the slab, false otherwise.
+     */
+    bool operator>(const SideCrossing& other) const { return part > other.part; };
+};
+
+/**
+ * @brief A Struct representing the length which is covered along a line of the slab, as a
+ *        linear function of the part of the height of the slab.
+ */
+struct CoveredLength
+{
+    CordType atBottom;  // The covered length at the bottom of the slab.
+    CordType slope;     // The change of the covered length from the bottom to the top.
+};
+
+/**
+ * @brief A Struct representing a task of neighbouring slabs of a group.
+ */
+struct SlabTask
+{
+    size_t group;       // The index of the group.
+    size_t firstSlab;   // The index of the first slab in the group.
+    size_t lastSlab;    // The index after the last slab in the group.
+};
+
+/**
+ * @brief A Struct representing the Shapes of all the groups, where every group keeps it's
+ *        Shapes sorted by their smallest Y value, and the Y values of their Vertices.
+ */
+struct ShapeGroups
+{
+    std::vector<ShapeIndex> shapes;     // The Shapes of all the groups, one group after another.
+    std::vector<size_t> firstShape;     // The index of the first Shape of every group.
+    std::vector<CordType> bounds;       // The Y values of all the groups, one group after another.
+    std::vector<size_t> firstBound;     // The index of the first Y value of every group.
+};
+
+/**
+ * @brief A Struct representing the memory which a worker thread uses for the slabs.
+ */
+struct SlabScratch
+{
+    std::vector<ShapeIndex> active;     // The Shapes which cross the current slab.
+    std::vector<SlabSide> sides;        // The sides of the active Shapes, from left to right.
+    std::vector<int> depths;            // The amount of Shapes which cover every gap of sides.
+    std::vector<SideCrossing> crossings; // The queue of the crossings of neighbouring sides.
+};
+
+
+/*-----=  Compensated Sum Helpers  =-----*/
+
+
+/**
+ * @brief Add the given value to the given compensated sum, keeping the rounding error of the
+ *        addition aside.
+ * @param total The compensated sum.
+ * @param value The value to add.
+ */
+static void addCompensated(CompensatedSum& total, CordType const value)
+{
+    CordType sum = total.sum + value;
+    if (std::fabs(total.sum) >= std::fabs(value))
+    {
+        total.compensation += (total.sum - sum) + value;
+    }
+    else
+    {
+        total.compensation += (value - sum) + total.sum;
+    }
+    total.sum = sum;
+}
+
+
+/*-----=  Group Helpers  =-----*/
+
+
+/**
+ * @brief Determine if all the values of the given Bounding Box are finite numbers.
+ * @param box The Bounding Box to check.
+ * @return true if all the values are finite, false otherwise.
+ */
+static bool isFinite(const BoundingBox& box)
+{
+    return std::isfinite(box.getMinX()) && std::isfinite(box.getMaxX()) &&
+           std::isfinite(box.getMinY()) && std::isfinite(box.getMaxY());
+}
+
+/**
+ * @brief Find the Shape which stands for the group of the given Shape, shortening the path of
+ *        the Shape on the way.
+ * @param parents The parent of every Shape in it's group.
+ * @param shape The index of the Shape.
+ * @return The index of the Shape which stands for the group.
+ */
+static ShapeIndex findGroup(std::vector<ShapeIndex>& parents, ShapeIndex shape)
+{
+    while (parents[shape] != shape)
+    {
+        parents[shape] = parents[parents[shape]];
+        shape = parents[shape];
+    }
+    return shape;
+}
+
+/**
+ * @brief Join the groups of the given Shapes, where the group of both is kept by the Shape with
+ *        the smallest index.
+ * @param parents The parent of every Shape in it's group.
+ * @param first The index of the first Shape.
+ * @param second The index of the second Shape.
+ */
+static void joinGroups(std::vector<ShapeIndex>& parents, ShapeIndex first, ShapeIndex second)
+{
+    first = findGroup(parents, first);
+    second = findGroup(parents, second);
+    parents[std::max(first, second)] = std::min(first, second);
+}
+
+/**
+ * @brief Split the given Shapes to groups of Shapes which their Bounding Boxes overlap, where a
+ *        Shape which overlaps no other Shape is left out of the groups. The groups are kept in
+ *        the order of their first Shape.
+ * @param shapes The Shapes to split.
+ * @param groups The groups of the Shapes.
+ * @param alone The Vector which the Shapes that are left out are added to, in their order.
+ */
+static void findGroups(const ShapeStore& shapes, ShapeGroups& groups,
+                       std::vector<ShapeIndex>& alone)
+{
+    ShapeIndex count = shapes.size();
+    ThreadCount threads = getThreadCount();
+    std::vector<std::vector<ShapeIndex>> forests(threads, std::vector<ShapeIndex>(count));
+    std::vector<std::vector<bool>> marks(threads, std::vector<bool>(count, false));
+    for (ThreadCount t = 0; t < threads; t++)
+    {
+        for (ShapeIndex i = 0; i < count; i++)
+        {
+            forests[t][i] = i;
+        }
+    }
+
+    // Every pair is joined as soon as the tree finds it, in the groups of it's thread.
+    RTree tree;
+    tree.build(shapes);
+    tree.forEachCandidatePair([&shapes, &forests, &marks](ShapeIndex first, ShapeIndex second,
+                                                         ThreadCount thread)
+    {
+        // A Shape which is not finite is counted by it's own area, so it joins no group.
+        if (!isFinite(shapes.getBoundingBox(first)) || !isFinite(shapes.getBoundingBox(second)))
+        {
+            return;
+        }
+        joinGroups(forests[thread], first, second);
+        marks[thread][first] = true;
+        marks[thread][second] = true;
+    });
+
+    // The groups of the other threads are joined to the groups of the first thread.
+    std::vector<ShapeIndex>& parents = forests.front();
+    std::vector<bool>& joined = marks.front();
+    for (ThreadCount t = 1; t < threads; t++)
+    {
+        for (ShapeIndex i = 0; i < count; i++)
+        {
+            if (marks[t][i])
+            {
+                joinGroups(parents, i, findGroup(forests[t], i));
+                joined[i] = true;
+            }
+        }
+    }
+
+    // Number the groups in the order of their first Shape, and place the Shapes of every group.
+    std::vector<size_t> groupOf(count);
+    groups.firstShape.assign(1, 0);
+    for (ShapeIndex i = 0; i < count; i++)
+    {
+        if (!joined[i])
+        {
+            alone.push_back(i);
+            continue;
+        }
+        ShapeIndex root = findGroup(parents, i);
+        if (root == i)
+        {
+            groupOf[i] = groups.firstShape.size() - 1;
+            groups.firstShape.push_back(0);
+        }
+        else
+        {
+            groupOf[i] = groupOf[root];
+        }
+        groups.firstShape[groupOf[i] + 1]++;
+    }
+    for (size_t g = 1; g < groups.firstShape.size(); g++)
+    {
+        groups.firstShape[g] += groups.firstShape[g - 1];
+    }
+    std::vector<size_t> next(groups.firstShape.begin(), groups.firstShape.end() - 1);
+    groups.shapes.resize(groups.firstShape.back());
+    for (ShapeIndex i = 0; i < count; i++)
+    {
+        if (joined[i])
+        {
+            groups.shapes[next[groupOf[i]]++] = i;
+        }
+    }
+
+    // Sort the Shapes of every group by their smallest Y value, and keep the distinct Y values
+    // of their Vertices.
+    groups.firstBound.assign(1, 0);
+    for (size_t g = 0; g + 1 < groups.firstShape.size(); g++)
+    {
+        auto first = groups.shapes.begin() + groups.firstShape[g];
+        auto last = groups.shapes.begin() + groups.firstShape[g + 1];
+        std::stable_sort(first, last, [&shapes](ShapeIndex a, ShapeIndex b)
+        {
+            return shapes.getBoundingBox(a).getMinY() < shapes.getBoundingBox(b).getMinY();
+        });
+
+        size_t begin = groups.bounds.size();
+        for (auto i = first; i != last; i++)
+        {
+            ShapeView shape = shapes.getShape(*i);
+            for (ShapeSize k = 0; k < shape.getVertexCount(); k++)
+            {
+                groups.bounds.push_back(shape.getY(k));
+            }
+        }
+        std::sort(groups.bounds.begin() + begin, groups.bounds.end());
+        groups.bounds.erase(std::unique(groups.bounds.begin() + begin, groups.bounds.end()),
+                            groups.bounds.end());
+        groups.firstBound.push_back(groups.bounds.size());
+    }
+}
+
+
+/*-----=  Slab Helpers  =-----*/
+
+
+/**
+ * @brief Find the left side and the right side of the given Shape in the given slab, where the
+ *        Shape covers the convex hull of it's Vertices. No Vertex of the Shape is inside the
+ *        slab, so every side is a single line between 2 Vertices across the whole slab, and it
+ *        is the leftmost or the rightmost of these lines in the middle of the slab. A Trapezoid
+ *        which it's Vertices are given in a crossing order covers the Trapezoid between it's
+ *        bases, the same area which it's own area counts.
+ * @param shape The Shape which crosses the slab.
+ * @param bottom The Y value of the bottom of the slab.
+ * @param top The Y value of the top of the slab.
+ * @param sides The Vector which the left side and then the right side are added to, numbered
+ *        by their position in the Vector.
+ * @return true if the sides were found, false if the Shape does not cover the slab.
+ */
+static bool findSides(const ShapeView& shape, CordType const bottom, CordType const top,
+                      std::vector<SlabSide>& sides)
+{
+    SlabSide left = {EMPTY_AREA, EMPTY_AREA, OPEN_DEPTH, sides.size()};
+    SlabSide right = {EMPTY_AREA, EMPTY_AREA, CLOSE_DEPTH, sides.size() + 1};
+    bool found = false;
+    ShapeSize count = shape.getVertexCount();
+    for (ShapeSize i = 0; i < count; i++)
+    {
+        for (ShapeSize j = i + 1; j < count; j++)
+        {
+            CordType x1 = shape.getX(i), y1 = shape.getY(i);
+            CordType x2 = shape.getX(j), y2 = shape.getY(j);
+            if (std::min(y1, y2) > bottom || std::max(y1, y2) < top)
+            {
+                continue;
+            }
+            CordType slope = (x2 - x1) / (y2 - y1);
+            CordType lineBottom = x1 + (bottom - y1) * slope;
+            CordType lineTop = x1 + (top - y1) * slope;
+            if (!found || lineBottom + lineTop < left.bottom + left.top)
+            {
+                left.bottom = lineBottom;
+                left.top = lineTop;
+            }
+            if (!found || lineBottom + lineTop > right.bottom + right.top)
+            {
+                right.bottom = lineBottom;
+                right.top = lineTop;
+            }
+            found = true;
+        }
+    }
+    if (!found)
+    {
+        return false;
+    }
+    sides.push_back(left);
+    sides.push_back(right);
+    return true;
+}
+
+/**
+ * @brief Determine if the first given side comes before the second given side at the bottom of
+ *        the slab, where sides which start together are ordered by their top.
+ * @param first The first side.
+ * @param second The second side.
+ * @return true if the first side comes before the second side, false otherwise.
+ */
+static bool isSideBefore(const SlabSide& first, const SlabSide& second)
+{
+    if (first.bottom != second.bottom)
+    {
+        return first.bottom < second.bottom;
+    }
+    return first.top < second.top;
+}
+
+/**
+ * @brief Add the part of the covered length which comes from the gap after the side in the given
+ *        position, multiplied by the given sign, if some Shape covers the gap.
+ * @param scratch The memory of the slab.
+ * @param position The position of the side before the gap.
+ * @param sign 1 to add the gap, and -1 to remove it.
+ * @param length The covered length to update.
+ */
+static void addGap(const SlabScratch& scratch, size_t const position, int const sign,
+                   CoveredLength& length)
+{
+    if (position + 1 >= scratch.sides.size() || scratch.depths[position] <= 0)
+    {
+        return;
+    }
+    const SlabSide& left = scratch.sides[position];
+    const SlabSide& right = scratch.sides[position + 1];
+    length.atBottom += sign * (right.bottom - left.bottom);
+    length.slope += sign * ((right.top - right.bottom) - (left.top - left.bottom));
+}
+
+/**
+ * @brief Add the crossing of the neighbouring sides in the given position and after it to the
+ *        queue, if they cross after the given part of the slab.
+ * @param scratch The memory of the slab.
+ * @param position The position of the left side of the two.
+ * @param current The current part of the height of the slab.
+ */
+static void queueCrossing(SlabScratch& scratch, size_t const position, CordType const current)
+{
+    if (position + 1 >= scratch.sides.size())
+    {
+        return;
+    }
+    const SlabSide& left = scratch.sides[position];
+    const SlabSide& right = scratch.sides[position + 1];
+    CordType bottomGap = left.bottom - right.bottom;
+    CordType topGap = left.top - right.top;
+    if (topGap <= 0)
+    {
+        // The left side stays on the left until the top of the slab.
+        return;
+    }
+    CordType part = std::max(bottomGap / (bottomGap - topGap), current);
+    if (part < SLAB_TOP_PART)
+    {
+        scratch.crossings.push_back({part, position, left.id, right.id});
+        std::push_heap(scratch.crossings.begin(), scratch.crossings.end(),
+                       std::greater<SideCrossing>());
+    }
+}
+
+/**
+ * @brief Add the area of the union of the active Shapes inside the given slab to the given sum.
+ *        The sides of the Shapes are kept in their order from left to right while moving up the
+ *        slab, and only neighbouring sides can cross, so the order changes by swapping two
+ *        neighbours. Between two crossings the covered length changes linearly, so every part
+ *        is summed as a Trapezoid, and a swap updates the covered length only around it.
+ * @param shapes The ShapeStore which holds the Shapes.
+ * @param scratch The memory of the slab, which holds the active Shapes.
+ * @param bottom The Y value of the bottom of the slab.
+ * @param top The Y value of the top of the slab.
+ * @param total The sum to add the area to.
+ */
+static void addSlabArea(const ShapeStore& shapes, SlabScratch& scratch, CordType const bottom,
+                        CordType const top, CompensatedSum& total)
+{
+    scratch.sides.clear();
+    for (auto i = scratch.active.begin(); i != scratch.active.end(); i++)
+    {
+        findSides(shapes.getShape(*i), bottom, top, scratch.sides);
+    }
+    if (scratch.sides.empty())
+    {
+        return;
+    }
+    std::sort(scratch.sides.begin(), scratch.sides.end(), isSideBefore);
+
+    // Find the depth of every gap and the covered length at the bottom of the slab.
+    CoveredLength length = {EMPTY_AREA, EMPTY_AREA};
+    scratch.depths.resize(scratch.sides.size());
+    scratch.crossings.clear();
+    for (size_t i = 0; i < scratch.sides.size(); i++)
+    {
+        scratch.depths[i] = (i == 0 ? 0 : scratch.depths[i - 1]) + scratch.sides[i].depth;
+        addGap(scratch, i, OPEN_DEPTH, length);
+        queueCrossing(scratch, i, SLAB_BOTTOM_PART);
+    }
+
+    CordType height = top - bottom;
+    CordType lastPart = SLAB_BOTTOM_PART;
+    CordType lastLength = length.atBottom;
+    while (!scratch.crossings.empty())
+    {
+        SideCrossing crossing = scratch.crossings.front();
+        std::pop_heap(scratch.crossings.begin(), scratch.crossings.end(),
+                      std::greater<SideCrossing>());
+        scratch.crossings.pop_back();
+        size_t k = crossing.position;
+        if (scratch.sides[k].id != crossing.left || scratch.sides[k + 1].id != crossing.right)
+        {
+            // One of the sides was already swapped with another neighbour.
+            continue;
+        }
+
+        CordType currentLength = length.atBottom + length.slope * crossing.part;
+        addCompensated(total, ((lastLength + currentLength) * ((crossing.part - lastPart) * height))
+                              * HALF);
+        lastPart = crossing.part;
+        lastLength = currentLength;
+
+        // Swap the two sides, and update the gaps around them.
+        for (size_t gap = k == 0 ? k : k - 1; gap <= k + 1; gap++)
+        {
+            addGap(scratch, gap, CLOSE_DEPTH, length);
+        }
+        std::swap(scratch.sides[k], scratch.sides[k + 1]);
+        scratch.depths[k] = (k == 0 ? 0 : scratch.depths[k - 1]) + scratch.sides[k].depth;
+        for (size_t gap = k == 0 ? k : k - 1; gap <= k + 1; gap++)
+        {
+            addGap(scratch, gap, OPEN_DEPTH, length);
+        }
+        if (k > 0)
+        {
+            queueCrossing(scratch, k - 1, lastPart);
+        }
+        queueCrossing(scratch, k + 1, lastPart);
+    }
+
+    CordType topLength = length.atBottom + length.slope * SLAB_TOP_PART;
+    addCompensated(total, ((lastLength + topLength) * ((SLAB_TOP_PART - lastPart) * height))
+                          * HALF);
+}
+
+/**
+ * @brief Sum the area of the union of the Shapes of a group inside the slabs of the given task.
+ *        The active Shapes are updated while the task moves up from slab to slab.
+ * @param shapes The ShapeStore which holds the Shapes.
+ * @param groups The groups of the Shapes.
+ * @param task The task to handle.
+ * @param scratch The memory of the worker thread.
+ * @return The compensated sum of the area.
+ */
+static CompensatedSum sumTask(const ShapeStore& shapes, const ShapeGroups& groups,
+                              const SlabTask& task, SlabScratch& scratch)
+{
+    CompensatedSum total = {EMPTY_AREA, EMPTY_AREA};
+    const ShapeIndex *members = groups.shapes.data() + groups.firstShape[task.group];
+    size_t memberCount = groups.firstShape[task.group + 1] - groups.firstShape[task.group];
+    const CordType *bounds = groups.bounds.data() + groups.firstBound[task.group];
+
+    scratch.active.clear();
+    size_t next = 0;
+    for (size_t s = task.firstSlab; s < task.lastSlab; s++)
+    {
+        CordType bottom = bounds[s];
+        CordType top = bounds[s + 1];
+
+        // A Shape crosses the slab if it starts at or below it's bottom and ends at or above
+        // it's top.
+        while (next < memberCount && shapes.getBoundingBox(members[next]).getMinY() <= bottom)
+        {
+            if (shapes.getBoundingBox(members[next]).getMaxY() >= top)
+            {
+                scratch.active.push_back(members[next]);
+            }
+            next++;
+        }
+        scratch.active.erase(std::remove_if(scratch.active.begin(), scratch.active.end(),
+                                            [&shapes, top](ShapeIndex shape)
+                                            {
+                                                return shapes.getBoundingBox(shape).getMaxY() <
+                                                       top;
+                                            }), scratch.active.end());
+        addSlabArea(shapes, scratch, bottom, top, total);
+    }
+    return total;
+}
+
+
+/*-----=  Union Area Methods  =-----*/
+
+
+/**
+ * @brief Calculate the area of the union of all the given Shapes, i.e. the area which is covered
+ *        by at least one Shape. The slabs are handled by all the worker threads, and their areas
+ *        are summed in their order with a compensated sum, so the result does not depend on the
+ *        amount of threads. A Shape with a coordinate that is not a finite number is counted by
+ *        it's own area.
+ * @param shapes The Shapes to calculate the area of their union.
+ * @return The area of the union of the Shapes.
+ */
+CordType calculateUnionArea(const ShapeStore& shapes)
+{
+    ShapeGroups groups;
+    std::vector<ShapeIndex> alone;
+    findGroups(shapes, groups, alone);
+
+    std::vector<SlabTask> tasks;
+    for (size_t g = 0; g + 1 < groups.firstBound.size(); g++)
+    {
+        size_t slabs = groups.firstBound[g + 1] - groups.firstBound[g] - 1;
+        for (size_t s = 0; s < slabs; s += SLABS_PER_TASK)
+        {
+            tasks.push_back({g, s, std::min(s + SLABS_PER_TASK, slabs)});
+        }
+    }
+
+    ThreadCount threads = getThreadCount();
+    std::vector<CompensatedSum> results(tasks.size());
+    std::vector<SlabScratch> scratches(threads);
+    parallelForBlocks(tasks.size(), TASK_BLOCK_SIZE, threads,
+                      [&shapes, &groups, &tasks, &results, &scratches](size_t begin, size_t end,
+                                                                       ThreadCount thread)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            results[i] = sumTask(shapes, groups, tasks[i], scratches[thread]);
+        }
+    });
+
+    // A Shape which overlaps no other Shape adds it's own area.
+    CompensatedSum total = {EMPTY_AREA, EMPTY_AREA};
+    for (auto i = results.begin(); i != results.end(); i++)
+    {
+        addCompensated(total, i -> sum);
+        addCompensated(total, i -> compensation);
+    }
+    for (auto i = alone.begin(); i != alone.end(); i++)
+    {
+        addCompensated(total, shapes.getArea(*i));
+    }
+
+    // A sum which is not finite has no meaningful rounding error.
+    return std::isfinite(total.sum) ? total.sum + total.compensation : total.sum;
+}
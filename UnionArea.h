@@ -0,0 +1,48 @@
+/**
+ * @file UnionArea.h
+ * @author Itai Tagar <itagar>
+ * @version 1.0
+ * @date 16 Oct 2026
+ *
+ * @brief A Header File for the area of the union of the Shapes.
+ *
+ * @section LICENSE
+ * This program is free to use in every operation system.
+ *
+ * @section DESCRIPTION
+ * A Header File for the area of the union of the Shapes.
+ * The Shapes are split to groups of Shapes which their Bounding Boxes overlap, so a Shape which
+ * overlaps no other Shape never meets the others. Every group is cut to horizontal slabs at the
+ * Y values of it's Vertices, where every Shape which crosses a slab is a Trapezoid with bases
+ * parallel to the X axis, the same way the area of a Trapezoid is calculated. The covered length
+ * along the slab changes linearly between the Y values where the sides of the Trapezoids cross,
+ * so the area of the union is summed exactly from these parts.
+ */
+
+
+#ifndef UNIONAREA_H
+#define UNIONAREA_H
+
+
+/*-----=  Includes  =-----*/
+
+
+#include "ShapeStore.h"
+
+
+/*-----=  Union Area Methods  =-----*/
+
+
+/**
+ * @brief Calculate the area of the union of all the given Shapes, i.e. the area which is covered
+ *        by at least one Shape. The slabs are handled by all the worker threads, and their areas
+ *        are summed in their order with a compensated sum, so the result does not depend on the
+ *        amount of threads. A Shape with a coordinate that is not a finite number is counted by
+ *        it's own area.
+ * @param shapes The Shapes to calculate the area of their union.
+ * @return The area of the union of the Shapes.
+ */
+CordType calculateUnionArea(const ShapeStore& shapes);
+
+
+#endif